@@ -0,0 +1,632 @@
+/*----------------------------------------------------------
+ - ファイル名: bench.cpp
+ - 機能      : cpp/ 以下のデータ構造のベンチマーク
+ - 備考      : prelude.hpp は Makefile が template.cpp から main を除いて作る
+               各ケースは大きさ n の入力を seed 固定の乱数で作り、操作の部分だけを計測する
+               入出力を行う FastIO.cpp と debug.cpp は対象にしない
+               debug.cpp は PROF_* マクロのために読み込む (-DPROFILE でも通るように)
+ - 使用例    : make -C bench run
+               make -C bench json LABEL=$(git rev-parse --short HEAD)
+----------------------------------------------------------*/
+#include "prelude.hpp"
+#include "../cpp/debug.cpp"
+#include "../cpp/math.cpp"
+#include "../cpp/modint.cpp"
+#include "../cpp/prime.cpp"
+#include "../cpp/Cumsum.cpp"
+#include "../cpp/BIT.cpp"
+#include "../cpp/SegmentTree.cpp"
+#include "../cpp/UnionFind.cpp"
+#include "../cpp/RollbackUnionFind.cpp"
+#include "../cpp/WeightedUnionFind.cpp"
+#include "../cpp/ConcurrentUnionFind.cpp"
+#include "../cpp/SCC.cpp"
+#include "../cpp/TwoSat.cpp"
+#include "../cpp/CSRGraph.cpp"
+#include "../cpp/Dijkstra.cpp"
+#include "../cpp/GridBFS.cpp"
+#include "../cpp/MaxFlow.cpp"
+#include "../cpp/MinCostFlow.cpp"
+#include "../cpp/HLD.cpp"
+#include "../cpp/Arena.cpp"
+#include "../cpp/ndarray.cpp"
+#include "../cpp/HashMap.cpp"
+#include "../cpp/RadixSort.cpp"
+#include "../cpp/Mo.cpp"
+#include "../cpp/DynamicBitset.cpp"
+#include "../cpp/WaveletMatrix.cpp"
+#include "../cpp/LiChaoTree.cpp"
+#include "../cpp/ConvexHullTrick.cpp"
+#include "bench.hpp"
+
+long long op_sum(long long a, long long b) { return a + b; }
+long long e_sum() { return 0; }
+long long inv_sum(long long a) { return -a; }
+
+// 長さ n の乱数列 ([0, m) の一様分布)
+std::vector<int> random_array(int n, int m, bench::Rng& rng) {
+    std::vector<int> a(n);
+    for (int& x : a) x = rng.uniform(m);
+    return a;
+}
+
+// n 頂点 m 本のランダムな辺
+std::vector<std::pair<int,int>> random_edges(int n, int m, bench::Rng& rng) {
+    std::vector<std::pair<int,int>> edges(m);
+    for (auto& [u, v] : edges) u = rng.uniform(n), v = rng.uniform(n);
+    return edges;
+}
+
+// n 頂点のランダムな木 (頂点 i の親は [0, i) から選ぶ)
+std::vector<std::pair<int,int>> random_tree(int n, bench::Rng& rng) {
+    std::vector<std::pair<int,int>> edges;
+    for (int i = 1; i < n; i++) edges.emplace_back(rng.uniform(i), i);
+    return edges;
+}
+
+void bench_cumsum(int n, bench::Rng& rng) {
+    std::vector<int> a = random_array(n, 1000000000, rng);
+    std::vector<int> l = random_array(n, n, rng), r = random_array(n, n, rng);
+    bench::measure("Cumsum/build", n, n, [&] {
+        Cumsum c(a);
+        bench::do_not_optimize(c);
+    });
+    Cumsum c(a);
+    bench::measure("Cumsum/sum", n, n, [&] {
+        long long s = 0;
+        for (int i = 0; i < n; i++) s += c.sum(std::min(l[i], r[i]), std::max(l[i], r[i]));
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_bit(int n, bench::Rng& rng) {
+    std::vector<int> p = random_array(n, n, rng), r = random_array(n, n + 1, rng);
+    BIT<long long> b(n);
+    bench::measure("BIT/add", n, n, [&] {
+        for (int i = 0; i < n; i++) b.add(p[i], i);
+    });
+    bench::measure("BIT/sum", n, n, [&] {
+        long long s = 0;
+        for (int i = 0; i < n; i++) s += b.sum(std::min(p[i], r[i]), std::max(p[i], r[i]));
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_segtree(int n, bench::Rng& rng) {
+    std::vector<int> p = random_array(n, n, rng), r = random_array(n, n + 1, rng);
+    SegmentTree<long long, op_sum, e_sum> seg(n);
+    bench::measure("SegmentTree/set", n, n, [&] {
+        for (int i = 0; i < n; i++) seg.set(p[i], (long long)i);
+    });
+    bench::measure("SegmentTree/prod", n, n, [&] {
+        long long s = 0;
+        for (int i = 0; i < n; i++) s += seg.prod(std::min(p[i], r[i]), std::max(p[i], r[i]));
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_unionfind(int n, bench::Rng& rng) {
+    auto edges = random_edges(n, n, rng);
+    auto queries = random_edges(n, n, rng);
+    UnionFind uf(n);
+    bench::measure("UnionFind/merge", n, n, [&] {
+        for (auto [u, v] : edges) uf.merge(u, v);
+    });
+    bench::measure("UnionFind/same", n, n, [&] {
+        int s = 0;
+        for (auto [u, v] : queries) s += uf.same(u, v);
+        bench::do_not_optimize(s);
+    });
+    bench::measure("UnionFind/groups_csr", n, n, [&] {
+        auto g = uf.groups_csr();
+        bench::do_not_optimize(g);
+    });
+}
+
+void bench_rollback_unionfind(int n, bench::Rng& rng) {
+    auto edges = random_edges(n, n, rng);
+    RollbackUnionFind uf(n);
+    bench::measure("RollbackUnionFind/merge+rollback", n, 2LL * n, [&] {
+        for (auto [u, v] : edges) uf.merge(u, v);
+        uf.rollback(0);
+    });
+}
+
+void bench_offline_dynamic_connectivity(int n, bench::Rng& rng) {
+    // 辺の追加・削除・問い合わせを n 回ずつ
+    OfflineDynamicConnectivity odc(n);
+    auto edges = random_edges(n, n, rng);
+    for (int i = 0; i < n; i++) {
+        odc.add_edge(edges[i].first, edges[i].second);
+        if (i >= n / 2) odc.remove_edge(edges[i - n / 2].first, edges[i - n / 2].second);
+        odc.query(rng.uniform(n), rng.uniform(n));
+    }
+    bench::measure("OfflineDynamicConnectivity/run", n, 3LL * n, [&] {
+        auto res = odc.run();
+        bench::do_not_optimize(res);
+    });
+}
+
+void bench_weighted_unionfind(int n, bench::Rng& rng) {
+    auto edges = random_edges(n, n, rng);
+    WeightedUnionFind<long long, op_sum, e_sum, inv_sum> uf(n);
+    bench::measure("WeightedUnionFind/merge", n, n, [&] {
+        int s = 0;
+        for (auto [u, v] : edges) s += uf.merge(u, v, (long long)u - v);
+        bench::do_not_optimize(s);
+    });
+    bench::measure("WeightedUnionFind/diff", n, n, [&] {
+        long long s = 0;
+        for (auto [u, v] : edges) s += uf.diff(u, v);
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_concurrent_unionfind(int n, bench::Rng& rng) {
+    auto edges = random_edges(n, n, rng);
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    ConcurrentUnionFind uf(n);
+    bench::measure("ConcurrentUnionFind/merge_parallel", n, n, [&] {
+        uf.merge_parallel(edges, threads);
+    });
+    bench::measure("ConcurrentUnionFind/labels", n, n, [&] {
+        auto id = uf.labels(threads);
+        bench::do_not_optimize(id);
+    });
+}
+
+void bench_scc(int n, bench::Rng& rng) {
+    auto edges = random_edges(n, 2 * n, rng);
+    SCC g(n);
+    for (auto [u, v] : edges) g.add_edge(u, v);
+    bench::measure("SCC/scc_ids", n, 3LL * n, [&] {
+        auto res = g.scc_ids();
+        bench::do_not_optimize(res);
+    });
+    bench::measure("SCC/condensation", n, 3LL * n, [&] {
+        auto res = g.condensation();
+        bench::do_not_optimize(res);
+    });
+}
+
+void bench_twosat(int n, bench::Rng& rng) {
+    // 充足可能になるよう、隠した解 x を満たす節だけを加える
+    std::vector<int> x = random_array(n, 2, rng);
+    TwoSat ts(n);
+    for (int k = 0; k < 2 * n; k++) {
+        int i = rng.uniform(n), j = rng.uniform(n);
+        ts.add_clause(i, x[i] == 1, j, rng.uniform(2) == 1);
+    }
+    bench::measure("TwoSat/satisfiable", n, 3LL * n, [&] {
+        bool ok = ts.satisfiable();
+        bench::do_not_optimize(ok);
+    });
+}
+
+void bench_modint(int n, bench::Rng& rng) {
+    using mint = modint998244353;
+    std::vector<mint> a(n);
+    for (auto& v : a) v = mint((long long)rng.next() % mint::mod());
+    bench::measure("modint/mul+add", n, 2LL * n, [&] {
+        mint s = 0;
+        for (int i = 0; i < n; i++) s = s * a[i] + a[n - 1 - i];
+        bench::do_not_optimize(s);
+    });
+    bench::measure("modint/inv", n, n, [&] {
+        mint s = 0;
+        for (int i = 0; i < n; i++) s += (a[i] + 1).inv();
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_math(int n, bench::Rng& rng) {
+    const long long MOD = 1000000007;
+    std::vector<int> a = random_array(n, 1000000, rng);
+    bench::measure("math/Power", n, n, [&] {
+        long long s = 0;
+        for (int i = 0; i < n; i++) s += Power(a[i], MOD - 2, MOD);
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_sieve(int n, bench::Rng& rng) {
+    std::vector<int> x = random_array(n, n - 1, rng);
+    bench::measure("SieveOfEratosthenes/build", n, n, [&] {
+        SieveOfEratosthenes sieve(n);
+        bench::do_not_optimize(sieve);
+    });
+    SieveOfEratosthenes sieve(n);
+    bench::measure("SieveOfEratosthenes/factorize", n, n, [&] {
+        std::pair<int,int> pe[SieveOfEratosthenes::MAX_DISTINCT_PRIMES];
+        int s = 0;
+        for (int i = 0; i < n; i++) s += sieve.factorize(x[i] + 2, pe);
+        bench::do_not_optimize(s);
+    });
+    bench::measure("SieveOfEratosthenes/for_each_divisor", n, n, [&] {
+        long long s = 0;
+        for (int i = 0; i < n; i++) sieve.for_each_divisor(x[i] + 1, [&](int d) { s += d; });
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_dijkstra(int n, bench::Rng& rng) {
+    auto edges = random_edges(n, 4 * n, rng);
+    CSRGraph<long long> g(n);
+    for (auto [u, v] : edges) g.add_edge(u, v, rng.uniform(1000000000));
+    g.build();
+    bench::measure("Dijkstra/radix", n, 5LL * n, [&] {
+        auto d = dijkstra_radix(g, 0);
+        bench::do_not_optimize(d);
+    });
+    bench::measure("Dijkstra/heap", n, 5LL * n, [&] {
+        auto d = dijkstra_heap(g, 0);
+        bench::do_not_optimize(d);
+    });
+}
+
+void bench_gridbfs(int n, bench::Rng& rng) {
+    int h = 1;
+    while (h * h < n) h++;
+    std::vector<std::string> grid(h, std::string(h, '.'));
+    for (auto& row : grid) {
+        for (char& c : row) c = (rng.uniform(4) == 0 ? '#' : '.');
+    }
+    grid[0][0] = '.';
+    GridBFS g(grid);
+    bench::measure("GridBFS/bfs", n, (long long)h * h, [&] { g.bfs({{0, 0}}); });
+    bench::measure("GridBFS/bfs01", n, (long long)h * h, [&] {
+        g.bfs01({{0, 0}}, [&](int i, int j) { return grid[i][j] == '#' ? 1 : 0; });
+    });
+}
+
+void bench_maxflow(int n, bench::Rng& rng) {
+    auto edges = random_edges(n, 4 * n, rng);
+    std::vector<int> cap = random_array(4 * n, 1000, rng);
+    // 2つのアルゴリズムを同じネットワークで測る
+    auto build = [&] {
+        MaxFlow<long long> g(n);
+        for (int i = 0; i < 4 * n; i++) g.add_edge(edges[i].first, edges[i].second, 1 + cap[i]);
+        return g;
+    };
+    MaxFlow<long long> g1 = build(), g2 = build();
+    long long f1 = 0, f2 = 0;
+    bench::measure("MaxFlow/dinic", n, 5LL * n, [&] { f1 = g1.flow(0, n - 1); });
+    bench::measure("MaxFlow/push_relabel", n, 5LL * n, [&] { f2 = g2.flow_push_relabel(0, n - 1); });
+    if (f1 != f2) {
+        fprintf(stderr, "[bench] Error: MaxFlow results differ (dinic: %lld, push_relabel: %lld).\n", f1, f2);
+        _exit(1);
+    }
+}
+
+void bench_mincostflow(int n, bench::Rng& rng) {
+    auto edges = random_edges(n, 4 * n, rng);
+    MinCostFlow<int, long long> g(n);
+    for (auto [u, v] : edges) g.add_edge(u, v, 1 + rng.uniform(10), rng.uniform(1000));
+    bench::measure("MinCostFlow/flow", n, 5LL * n, [&] {
+        auto res = g.flow(0, n - 1, 64);
+        bench::do_not_optimize(res);
+    });
+}
+
+void bench_hld(int n, bench::Rng& rng) {
+    auto edges = random_tree(n, rng);
+    auto queries = random_edges(n, n, rng);
+    HLD hld(n);
+    for (auto [u, v] : edges) hld.add_edge(u, v);
+    bench::measure("HLD/build", n, n, [&] { hld.build(0); });
+    SegmentTree<long long, op_sum, e_sum> seg(n);
+    for (int v = 0; v < n; v++) hld.set(seg, v, (long long)v);
+    bench::measure("HLD/lca", n, n, [&] {
+        long long s = 0;
+        for (auto [u, v] : queries) s += hld.lca(u, v);
+        bench::do_not_optimize(s);
+    });
+    bench::measure("HLD/prod_path", n, n, [&] {
+        long long s = 0;
+        for (auto [u, v] : queries) s += hld.prod_path(seg, u, v);
+        bench::do_not_optimize(s);
+    });
+    LCA lca(hld);
+    bench::measure("LCA/query", n, n, [&] {
+        long long s = 0;
+        for (auto [u, v] : queries) s += lca(u, v);
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_ndarray(int n, bench::Rng& rng) {
+    // n/4 x 2 x 2 の表で、前の行と同じ行の前の列を参照する DP (内側の次元が小さい場合)
+    int h = std::max(1, n / 4), w = 2;
+    long long seed = rng.uniform(1000);
+    bench::measure("ndarray/dp", n, 2LL * h * w * 2, [&] {
+        ndarray<long long, 3> a({h, w, 2}, seed);
+        for (int i = 1; i < h; i++) {
+            for (int j = 0; j < w; j++) {
+                for (int b = 0; b < 2; b++) a(i, j, b) = (a(i - 1, j, b ^ 1) + (j ? a(i, j - 1, b) : 0)) & 1023;
+            }
+        }
+        bench::do_not_optimize(a(h - 1, w - 1, 1));
+    });
+    bench::measure("ndarray/vvvl_dp", n, 2LL * h * w * 2, [&] {
+        std::vector<std::vector<std::vector<long long>>> a(h, std::vector<std::vector<long long>>(w, std::vector<long long>(2, seed)));
+        for (int i = 1; i < h; i++) {
+            for (int j = 0; j < w; j++) {
+                for (int b = 0; b < 2; b++) a[i][j][b] = (a[i - 1][j][b ^ 1] + (j ? a[i][j - 1][b] : 0)) & 1023;
+            }
+        }
+        bench::do_not_optimize(a[h - 1][w - 1][1]);
+    });
+}
+
+void bench_arena(int n, bench::Rng& rng) {
+    // テストケースごとに長さの異なる vector を作って捨てる
+    std::vector<int> len = random_array(1024, std::max(1, n / 64), rng);
+    Arena arena;
+    bench::measure("Arena/avector", n, 1024, [&] {
+        long long s = 0;
+        for (int t = 0; t < 1024; t++) {
+            arena.reset();
+            avector<int> v(len[t] + 1, t, arena);
+            s += v.back();
+        }
+        bench::do_not_optimize(s);
+    });
+    bench::measure("Arena/vector", n, 1024, [&] {
+        long long s = 0;
+        for (int t = 0; t < 1024; t++) {
+            std::vector<int> v(len[t] + 1, t);
+            s += v.back();
+        }
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_hashmap(int n, bench::Rng& rng) {
+    // n 種類のキーに対する 8n 回の操作 (半分が加算、半分が検索)
+    std::vector<long long> pool(n), keys(8LL * n);
+    for (auto& k : pool) k = (long long)(rng.next() >> 2);
+    for (auto& k : keys) k = pool[rng.uniform(n)];
+    bench::measure("HashMap/mix", n, (long long)keys.size(), [&] {
+        HashMap<long long, int> mp;
+        long long s = 0;
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (i & 1) mp[keys[i]]++;
+            else s += mp.count(keys[i]);
+        }
+        bench::do_not_optimize(s);
+    });
+    bench::measure("HashMap/unordered_map_mix", n, (long long)keys.size(), [&] {
+        std::unordered_map<long long, int> mp;
+        long long s = 0;
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (i & 1) mp[keys[i]]++;
+            else s += mp.count(keys[i]);
+        }
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_radix_sort(int n, bench::Rng& rng) {
+    // 値の範囲が [0, 1e9) の long long (座標圧縮の典型的な入力)
+    std::vector<long long> a(n);
+    for (auto& x : a) x = rng.uniform(1000000000);
+    bench::measure("RadixSort/radix_sort", n, n, [&] {
+        std::vector<long long> b = a;
+        radix_sort(b);
+        bench::do_not_optimize(b);
+    });
+    bench::measure("RadixSort/std_sort", n, n, [&] {
+        std::vector<long long> b = a;
+        std::sort(b.begin(), b.end());
+        bench::do_not_optimize(b);
+    });
+    bench::measure("RadixSort/Compressor", n, n, [&] {
+        Compressor<long long> c(a);
+        bench::do_not_optimize(c);
+    });
+    bench::measure("RadixSort/sort_unique_lower_bound", n, n, [&] {
+        std::vector<long long> u = a;
+        std::sort(u.begin(), u.end());
+        u.erase(std::unique(u.begin(), u.end()), u.end());
+        std::vector<int> id(n);
+        for (int i = 0; i < n; i++) id[i] = (int)(std::lower_bound(u.begin(), u.end(), a[i]) - u.begin());
+        bench::do_not_optimize(id);
+    });
+}
+
+void bench_mo(int n, bench::Rng& rng) {
+    // 区間の異なる値の個数 (q = n)
+    std::vector<int> a(n), ls(n), rs(n);
+    for (auto& x : a) x = rng.uniform(n);
+    rep(i, n) {
+        ls[i] = rng.uniform(n + 1);
+        rs[i] = rng.uniform(n + 1);
+        if (ls[i] > rs[i]) std::swap(ls[i], rs[i]);
+    }
+    bench::measure("Mo/distinct", n, n, [&] {
+        Mo mo(n);
+        rep(i, n) mo.add(ls[i], rs[i]);
+        std::vector<int> cnt(n);
+        int kind = 0;
+        long long sum = 0;
+        mo.run([&](int i) { if (cnt[a[i]]++ == 0) kind++; }, [&](int i) { if (--cnt[a[i]] == 0) kind--; }, [&](int) { sum += kind; });
+        bench::do_not_optimize(sum);
+    });
+    bench::measure("Mo/with_updates", n, n, [&] {
+        // 半分を1点更新にする
+        MoWithUpdates mo(n);
+        std::vector<int> b = a, ps, xs;
+        rep(i, n) {
+            if (i % 2) {
+                mo.add_update();
+                ps.push_back(rng.uniform(n));
+                xs.push_back(rng.uniform(n));
+            } else {
+                mo.add_query(ls[i], rs[i]);
+            }
+        }
+        std::vector<int> cnt(n);
+        int kind = 0;
+        long long sum = 0;
+        auto add = [&](int i) { if (cnt[b[i]]++ == 0) kind++; };
+        auto erase = [&](int i) { if (--cnt[b[i]] == 0) kind--; };
+        auto update = [&](int t, int l, int r) {
+            int p = ps[t];
+            if (l <= p && p < r) {
+                erase(p);
+                std::swap(b[p], xs[t]);
+                add(p);
+            } else {
+                std::swap(b[p], xs[t]);
+            }
+        };
+        mo.run(add, erase, update, [&](int) { sum += kind; });
+        bench::do_not_optimize(sum);
+    });
+    bench::measure("Mo/rollback", n, n, [&] {
+        // 区間の同じ値の個数の最大値
+        RollbackMo mo(n);
+        rep(i, n) mo.add(ls[i], rs[i]);
+        std::vector<int> cnt(n);
+        std::vector<std::pair<int, int>> hist;
+        int best = 0, saved_best = 0;
+        size_t saved_size = 0;
+        long long sum = 0;
+        auto add = [&](int i) {
+            hist.push_back({a[i], cnt[a[i]]});
+            best = std::max(best, ++cnt[a[i]]);
+        };
+        auto reset = [&]() {
+            for (auto [c, k] : hist) cnt[c] = 0;
+            hist.clear();
+            best = 0;
+        };
+        auto snapshot = [&]() {
+            saved_size = hist.size();
+            saved_best = best;
+        };
+        auto rollback = [&]() {
+            while (hist.size() > saved_size) {
+                cnt[hist.back().first] = hist.back().second;
+                hist.pop_back();
+            }
+            best = saved_best;
+        };
+        mo.run(add, add, reset, snapshot, rollback, [&](int) { sum += best; });
+        bench::do_not_optimize(sum);
+    });
+}
+
+void bench_dynamic_bitset(int n, bench::Rng& rng) {
+    // 部分和 DP (和の上限 n、品物 1000 個)
+    std::vector<int> items(1000);
+    for (auto& x : items) x = rng.uniform(std::max(1, n / 500)) + 1;
+    bench::measure("DynamicBitset/shift_or", n, 1000LL * (n / 64 + 1), [&] {
+        DynamicBitset dp(n + 1);
+        dp.set(0);
+        for (int a : items) dp.shift_or(a);
+        bench::do_not_optimize(dp);
+    });
+    // 推移閉包 (頂点数 sqrt(n) * 2、辺数は頂点数の 3 倍)
+    const int v = std::max(2, (int)std::sqrt((double)n) * 2);
+    std::vector<DynamicBitset> g(v, DynamicBitset(v));
+    rep(i, 3 * v) g[rng.uniform(v)].set(rng.uniform(v));
+    bench::measure("DynamicBitset/transitive_closure", v, (long long)v * v * (v / 64 + 1), [&] {
+        std::vector<DynamicBitset> reach = g;
+        transitive_closure(reach);
+        bench::do_not_optimize(reach);
+    });
+}
+
+void bench_wavelet_matrix(int n, bench::Rng& rng) {
+    std::vector<long long> a(n);
+    for (auto& x : a) x = rng.uniform(1000000000);
+    std::vector<int> ls(n), rs(n), ks(n);
+    rep(i, n) {
+        ls[i] = rng.uniform(n);
+        rs[i] = rng.uniform(n);
+        if (ls[i] > rs[i]) std::swap(ls[i], rs[i]);
+        rs[i]++;
+        ks[i] = rng.uniform(rs[i] - ls[i]);
+    }
+    bench::measure("WaveletMatrix/build", n, n, [&] {
+        WaveletMatrix<long long> wm(a);
+        bench::do_not_optimize(wm);
+    });
+    WaveletMatrix<long long> wm(a);
+    bench::measure("WaveletMatrix/kth_smallest", n, n, [&] {
+        long long s = 0;
+        rep(i, n) s += wm.kth_smallest(ls[i], rs[i], ks[i]);
+        bench::do_not_optimize(s);
+    });
+    bench::measure("WaveletMatrix/count_less", n, n, [&] {
+        long long s = 0;
+        rep(i, n) s += wm.count_less(ls[i], rs[i], a[ks[i]]);
+        bench::do_not_optimize(s);
+    });
+}
+
+void bench_line_container(int n, bench::Rng& rng) {
+    // dp[i] = min_{j<i} (dp[j] + (X[i] - X[j])^2) + C (X は昇順)
+    const long long C = 1000000000LL;
+    std::vector<long long> xs(n), dp(n);
+    xs[0] = 0;
+    for (int i = 1; i < n; i++) xs[i] = xs[i - 1] + rng.uniform(1000) + 1;
+    bench::measure("LiChaoTree/dp", n, n, [&] {
+        LiChaoTree<long long> lc(xs);
+        lc.add_line(-2 * xs[0], xs[0] * xs[0]);
+        for (int i = 1; i < n; i++) {
+            dp[i] = xs[i] * xs[i] + C + lc.get(xs[i]);
+            lc.add_line(-2 * xs[i], dp[i] + xs[i] * xs[i]);
+        }
+        bench::do_not_optimize(dp);
+    });
+    bench::measure("DynamicLiChaoTree/dp", n, n, [&] {
+        DynamicLiChaoTree<long long> lc(0, xs[n - 1], n);
+        lc.add_line(-2 * xs[0], xs[0] * xs[0]);
+        for (int i = 1; i < n; i++) {
+            dp[i] = xs[i] * xs[i] + C + lc.get(xs[i]);
+            lc.add_line(-2 * xs[i], dp[i] + xs[i] * xs[i]);
+        }
+        bench::do_not_optimize(dp);
+    });
+    bench::measure("MonotoneCHT/dp", n, n, [&] {
+        MonotoneCHT<long long> cht;
+        cht.add_line(-2 * xs[0], xs[0] * xs[0]);
+        for (int i = 1; i < n; i++) {
+            dp[i] = xs[i] * xs[i] + C + cht.get_inc(xs[i]);
+            cht.add_line(-2 * xs[i], dp[i] + xs[i] * xs[i]);
+        }
+        bench::do_not_optimize(dp);
+    });
+}
+
+int main(int argc, char** argv) {
+    bench::add_case("Cumsum", bench_cumsum);
+    bench::add_case("BIT", bench_bit);
+    bench::add_case("SegmentTree", bench_segtree);
+    bench::add_case("UnionFind", bench_unionfind);
+    bench::add_case("RollbackUnionFind", bench_rollback_unionfind);
+    bench::add_case("OfflineDynamicConnectivity", bench_offline_dynamic_connectivity);
+    bench::add_case("WeightedUnionFind", bench_weighted_unionfind);
+    bench::add_case("ConcurrentUnionFind", bench_concurrent_unionfind);
+    bench::add_case("SCC", bench_scc);
+    bench::add_case("TwoSat", bench_twosat);
+    bench::add_case("modint", bench_modint);
+    bench::add_case("math", bench_math);
+    bench::add_case("SieveOfEratosthenes", bench_sieve);
+    bench::add_case("Dijkstra", bench_dijkstra);
+    bench::add_case("GridBFS", bench_gridbfs);
+    bench::add_case("MaxFlow", bench_maxflow);
+    bench::add_case("MinCostFlow", bench_mincostflow, 1 << 17);
+    bench::add_case("HLD", bench_hld);
+    bench::add_case("ndarray", bench_ndarray);
+    bench::add_case("Arena", bench_arena);
+    bench::add_case("HashMap", bench_hashmap);
+    bench::add_case("RadixSort", bench_radix_sort);
+    bench::add_case("Mo", bench_mo, 1 << 18);
+    bench::add_case("DynamicBitset", bench_dynamic_bitset);
+    bench::add_case("WaveletMatrix", bench_wavelet_matrix);
+    bench::add_case("LineContainer", bench_line_container);
+    return bench::main(argc, argv);
+}
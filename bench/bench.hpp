@@ -0,0 +1,283 @@
+/*----------------------------------------------------------
+ - ファイル名: bench.hpp
+ - 機能      : ベンチマークの計測と結果の出力を行う (ヘッダのみ、外部ライブラリ不要)
+ - 備考      : ケースは (名前, 関数) の組で登録し、入力の大きさごとに fork した
+               子プロセスで実行する。これによりケースごとの最大メモリ使用量
+               (getrusage の ru_maxrss) が他のケースの影響を受けない
+               乱数は seed 固定の splitmix64 なので、同じ seed なら同じ入力になる
+ - 使用例    : void bench_bit(int n, bench::Rng& rng) {
+                   BIT<long long> b(n);
+                   bench::measure("BIT/add", n, n, [&] { rep(i, n) b.add(rng.uniform(n), 1); });
+               }
+               int main(int argc, char** argv) {
+                   bench::add_case("BIT", bench_bit);
+                   return bench::main(argc, argv);
+               }
+----------------------------------------------------------*/
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace bench {
+
+/*----------------------------------------------------------
+ - クラス名  : Rng
+ - 機能      : seed 固定の乱数 (splitmix64)
+----------------------------------------------------------*/
+class Rng {
+    public:
+    explicit Rng(uint64_t seed) : state(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // [0, n) の一様乱数
+    int uniform(int n) { return (int)(next() % (uint64_t)n); }
+
+    private:
+    uint64_t state;
+};
+
+struct Result {
+    std::string name;
+    int n;            // 入力の大きさ
+    long long ops;    // 操作の回数
+    double seconds;   // 計測区間の時間
+    long peak_rss_kb; // 子プロセスの最大メモリ使用量
+};
+
+using CaseFunc = void (*)(int, Rng&);
+
+struct Case {
+    std::string name;
+    CaseFunc func;
+    int max_n; // これより大きい入力では実行しない
+};
+
+inline std::vector<Case>& cases() {
+    static std::vector<Case> c;
+    return c;
+}
+
+// 子プロセスで measure の結果を書き出すパイプ (親プロセスでは -1)
+inline int& result_fd() {
+    static int fd = -1;
+    return fd;
+}
+
+/*----------------------------------------------------------
+ - 関数名: do_not_optimize
+ - 機能  : 計算結果を使ったことにして、最適化で計算が消されるのを防ぐ
+----------------------------------------------------------*/
+template <class T>
+inline void do_not_optimize(const T& x) {
+    asm volatile("" : : "r"(&x) : "memory");
+}
+
+/*----------------------------------------------------------
+ - 関数名: add_case
+ - 機能  : ケースを登録する
+ - 引数  : const string& name : ケース名 (--filter で部分一致させる)
+           CaseFunc func : void(int n, Rng& rng)  大きさ n の入力を作って measure を呼ぶ
+           int max_n : 実行する入力の大きさの上限 (計算量の大きいケース用)
+----------------------------------------------------------*/
+inline void add_case(const std::string& name, CaseFunc func, int max_n = 1 << 30) {
+    cases().push_back(Case{name, func, max_n});
+}
+
+/*----------------------------------------------------------
+ - 関数名: measure
+ - 機能  : f() の実行時間を計測して結果に加える
+ - 引数  : const string& name : 計測の名前 ("構造/操作")
+           int n : 入力の大きさ
+           long long ops : f() の中で行う操作の回数 (ns/op の分母)
+           F f : 計測する処理 (入力の準備は f の外で行う)
+----------------------------------------------------------*/
+template <class F>
+void measure(const std::string& name, int n, long long ops, F f) {
+    auto t0 = std::chrono::steady_clock::now();
+    f();
+    auto t1 = std::chrono::steady_clock::now();
+    double sec = std::chrono::duration<double>(t1 - t0).count();
+
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    char line[512];
+    int len = snprintf(line, sizeof(line), "%s\t%d\t%lld\t%.9f\t%ld\n", name.c_str(), n, ops, sec, (long)ru.ru_maxrss);
+    if (result_fd() >= 0 && write(result_fd(), line, len) != len) _exit(1);
+}
+
+/*----------------------------------------------------------
+ - 関数名: run_case
+ - 機能  : ケースを子プロセスで1回実行し、measure の結果を返す
+ - 備考  : 子プロセスが異常終了したときは空を返す
+----------------------------------------------------------*/
+inline std::vector<Result> run_case(const Case& c, int n, uint64_t seed) {
+    std::vector<Result> res;
+    int fds[2];
+    if (pipe(fds) != 0) return res;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        result_fd() = fds[1];
+        Rng rng(seed ^ ((uint64_t)n * 0x9E3779B97F4A7C15ULL));
+        c.func(n, rng);
+        fflush(stdout);
+        _exit(0);
+    }
+    close(fds[1]);
+
+    std::string buf;
+    char tmp[4096];
+    ssize_t r;
+    while ((r = read(fds[0], tmp, sizeof(tmp))) > 0) buf.append(tmp, r);
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "[bench] Error: case %s (n = %d) failed.\n", c.name.c_str(), n);
+        return res;
+    }
+
+    size_t p = 0;
+    while (p < buf.size()) {
+        size_t q = buf.find('\n', p);
+        std::string line = buf.substr(p, q - p);
+        p = q + 1;
+        char name[256];
+        Result x;
+        if (sscanf(line.c_str(), "%255[^\t]\t%d\t%lld\t%lf\t%ld", name, &x.n, &x.ops, &x.seconds, &x.peak_rss_kb) == 5) {
+            x.name = name;
+            res.push_back(x);
+        }
+    }
+    return res;
+}
+
+/*----------------------------------------------------------
+ - 関数名: write_json
+ - 機能  : 結果を JSON で書き出す
+----------------------------------------------------------*/
+inline void write_json(FILE* fp, const std::vector<Result>& results, const std::string& label, uint64_t seed, int repeat) {
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"label\": \"%s\",\n", label.c_str());
+    fprintf(fp, "  \"compiler\": \"%s\",\n", __VERSION__);
+    fprintf(fp, "  \"seed\": %llu,\n", (unsigned long long)seed);
+    fprintf(fp, "  \"repeat\": %d,\n", repeat);
+    fprintf(fp, "  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& x = results[i];
+        fprintf(fp, "    {\"name\": \"%s\", \"n\": %d, \"ops\": %lld, \"seconds\": %.9f, \"ns_per_op\": %.3f, \"ops_per_sec\": %.1f, \"peak_rss_kb\": %ld}%s\n",
+                x.name.c_str(), x.n, x.ops, x.seconds, x.seconds * 1e9 / x.ops, x.ops / x.seconds, x.peak_rss_kb,
+                i + 1 < results.size() ? "," : "");
+    }
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+}
+
+/*----------------------------------------------------------
+ - 関数名: main
+ - 機能  : コマンドライン引数を解釈し、登録されたケースを全て実行する
+ - 引数  : --sizes a,b,c  : 入力の大きさ (既定値 1024,16384,131072,1048576)
+           --quick        : --sizes 1024,16384 と同じ
+           --filter str   : 名前に str を含むケースだけ実行する
+           --seed s       : 乱数の seed (既定値 1)
+           --repeat r     : 各ケースを r 回実行して最短の時間を採る (既定値 3)
+           --json file    : 結果を JSON で file に書き出す ("-" なら標準出力)
+           --label str    : JSON に記録する名前 (コミットの ID など)
+ - 戻り値: int : 全てのケースが成功したら 0
+----------------------------------------------------------*/
+inline int main(int argc, char** argv) {
+    std::vector<int> sizes = {1 << 10, 1 << 14, 1 << 17, 1 << 20};
+    std::string filter, json, label;
+    uint64_t seed = 1;
+    int repeat = 3;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        bool has_value = (i + 1 < argc);
+        if (a == "--quick") {
+            sizes = {1 << 10, 1 << 14};
+        } else if (a == "--sizes" && has_value) {
+            sizes.clear();
+            for (char* p = argv[++i]; *p;) {
+                sizes.push_back((int)strtol(p, &p, 10));
+                if (*p == ',') p++;
+            }
+        } else if (a == "--filter" && has_value) {
+            filter = argv[++i];
+        } else if (a == "--seed" && has_value) {
+            seed = strtoull(argv[++i], nullptr, 10);
+        } else if (a == "--repeat" && has_value) {
+            repeat = std::max(1, atoi(argv[++i]));
+        } else if (a == "--json" && has_value) {
+            json = argv[++i];
+        } else if (a == "--label" && has_value) {
+            label = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--quick] [--sizes a,b,c] [--filter str] [--seed s] [--repeat r] [--json file] [--label str]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // JSON を標準出力に書くときは表を標準エラー出力に回す
+    FILE* table = (json == "-" ? stderr : stdout);
+    fprintf(table, "%-38s %9s %12s %14s %12s\n", "name", "n", "ns/op", "ops/s", "peak RSS(KB)");
+
+    std::vector<Result> results;
+    bool ok = true;
+    for (const Case& c : cases()) {
+        if (c.name.find(filter) == std::string::npos) continue;
+        for (int n : sizes) {
+            if (n > c.max_n) continue;
+            // 同じ名前の計測は repeat 回のうち最短の時間を採る (メモリは最大を採る)
+            std::vector<Result> best;
+            for (int r = 0; r < repeat; r++) {
+                std::vector<Result> cur = run_case(c, n, seed);
+                if (cur.empty()) {
+                    ok = false;
+                    break;
+                }
+                if (best.empty()) {
+                    best = cur;
+                    continue;
+                }
+                for (size_t k = 0; k < best.size() && k < cur.size(); k++) {
+                    best[k].seconds = std::min(best[k].seconds, cur[k].seconds);
+                    best[k].peak_rss_kb = std::max(best[k].peak_rss_kb, cur[k].peak_rss_kb);
+                }
+            }
+            for (const Result& x : best) {
+                fprintf(table, "%-38s %9d %12.2f %14.0f %12ld\n", x.name.c_str(), x.n, x.seconds * 1e9 / x.ops,
+                        x.ops / x.seconds, x.peak_rss_kb);
+                results.push_back(x);
+            }
+            fflush(table);
+        }
+    }
+
+    if (!json.empty()) {
+        FILE* fp = (json == "-" ? stdout : fopen(json.c_str(), "w"));
+        if (fp == nullptr) {
+            fprintf(stderr, "[bench] Error: cannot open %s.\n", json.c_str());
+            return 1;
+        }
+        write_json(fp, results, label, seed, repeat);
+        if (fp != stdout) fclose(fp);
+    }
+    return ok ? 0 : 1;
+}
+
+} // namespace bench
@@ -0,0 +1,73 @@
+/*----------------------------------------------------------
+ - ファイル名: fastio_check.cpp
+ - 機能      : FastReader がパイプで、書き手が閉じていない入力を待ち続けないかを確かめる
+ - 備考      : インタラクティブな問題と同じく、子プロセスの標準入力をパイプにして、
+               親は1行書いたら子の返事を待ってから次の行を書く (その間パイプは開いたまま)
+               FastReader が届いた分だけで返らないと、子は返事をせずに止まる
+               返事が 5 秒以内に来なければ失敗とする
+ - 使用例    : make -C bench check
+----------------------------------------------------------*/
+#include "prelude.hpp"
+#include "../cpp/FastIO.cpp"
+#include <csignal>
+#include <poll.h>
+#include <sys/wait.h>
+
+// 子プロセス: 2回の問い合わせに答え、入力の終わりを確かめる
+int child_main() {
+    FastReader in;
+    long long a, b;
+    std::string s;
+    if (!in.read(a, b)) return 1;
+    printf("%lld\n", a + b);
+    fflush(stdout);
+    if (!in.read(s)) return 1;
+    printf("%s!\n", s.c_str());
+    fflush(stdout);
+    if (in.read(a)) return 1;
+    return 0;
+}
+
+// fd から1行読む (timeout_ms 以内に届かなければ false)
+bool read_line(int fd, std::string& line, int timeout_ms) {
+    line.clear();
+    while (true) {
+        pollfd p{fd, POLLIN, 0};
+        if (poll(&p, 1, timeout_ms) <= 0) return false;
+        char c;
+        if (read(fd, &c, 1) != 1) return false;
+        if (c == '\n') return true;
+        line += c;
+    }
+}
+
+int main() {
+    int to_child[2], from_child[2];
+    if (pipe(to_child) != 0 || pipe(from_child) != 0) return 1;
+    pid_t pid = fork();
+    if (pid == 0) {
+        dup2(to_child[0], 0);
+        dup2(from_child[1], 1);
+        close(to_child[0]);
+        close(to_child[1]);
+        close(from_child[0]);
+        close(from_child[1]);
+        _exit(child_main());
+    }
+    close(to_child[0]);
+    close(from_child[1]);
+
+    bool ok = true;
+    std::string line;
+    auto send = [&](const char* s) { return write(to_child[1], s, strlen(s)) == (ssize_t)strlen(s); };
+    ok = ok && send("3 -5\n") && read_line(from_child[0], line, 5000) && line == "-2";
+    ok = ok && send("hello\n") && read_line(from_child[0], line, 5000) && line == "hello!";
+    close(to_child[1]);
+
+    if (!ok) kill(pid, SIGKILL);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    printf("[fastio_check] %s\n", ok ? "ok" : "failed (FastReader blocked on an open pipe)");
+    return ok ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*----------------------------------------------------------
+ - クラス名  : Arena
+ - 機能      : まとめて解放する前提のメモリ領域 (バンプアロケータ)
+ - 備考      : 大きなブロックを確保しておき、要求ごとに先頭から切り出すだけで
+               個別の解放はしない。reset でブロックを残したまま全体を空にし、
+               次のテストケースで再利用する (デストラクタで全て解放する)
+               ブロックに収まらない大きさの要求は専用のブロックを確保する
+               切り出した領域に置いたオブジェクトのデストラクタは呼ばないので、
+               デストラクタが必要な型は使う側で破棄すること
+ - 使用例    : Arena arena(1 << 24);
+               rep(t, T) {
+                   arena.reset();                         // 前のテストケースの領域を全て解放
+                   avector<int> a(N, 0, arena);           // vector<int> と同じように使える
+                   ndarray<long long, 2> dp(arena, N, M);
+               }
+----------------------------------------------------------*/
+class Arena {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: Arena
+     - 機能  : コンストラクタ
+     - 引数  : size_t block_bytes : 1つのブロックの大きさ (バイト)
+     - 備考  : 最初のブロックは初めて allocate したときに確保する
+    ----------------------------------------------------------*/
+    explicit Arena(size_t block_bytes = 1 << 20) : block_size(block_bytes) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena() {
+        for (const Block& b : blocks) ::operator delete(b.ptr, std::align_val_t(BLOCK_ALIGN));
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: allocate
+     - 機能  : bytes バイトの領域を切り出して返す
+     - 引数  : size_t bytes : 大きさ
+               size_t align : アラインメント (2 の累乗、既定値は malloc と同じ 16)
+     - 戻り値: void* : 領域の先頭
+     - 備考  : ブロックの先頭は 64 バイトに揃っているので、それより大きい align は
+               アドレスを切り上げて揃える (新しいブロックはその分だけ大きく確保する)
+     - 計算量: O(1) (ブロックを使い切ったときだけ新しく確保する)
+    ----------------------------------------------------------*/
+    void* allocate(size_t bytes, size_t align = 16) {
+        if (align == 0 || (align & (align - 1)) != 0) {
+            printf("[Arena] Error: argument of allocate function is inappropriate.\n");
+            printf("align: %zu\n", align);
+            return nullptr;
+        }
+        while (true) {
+            if (cur == blocks.size()) {
+                size_t pad = (align > BLOCK_ALIGN ? align - BLOCK_ALIGN : 0);
+                size_t size = std::max(block_size, bytes + pad);
+                blocks.push_back(Block{(char*)::operator new(size, std::align_val_t(BLOCK_ALIGN)), size});
+                offset = 0;
+            }
+            const uintptr_t base = (uintptr_t)blocks[cur].ptr;
+            size_t p = ((base + offset + align - 1) & ~(uintptr_t)(align - 1)) - base;
+            if (p + bytes <= blocks[cur].size) {
+                offset = p + bytes;
+                used += bytes;
+                return blocks[cur].ptr + p;
+            }
+            // 残りは捨てて次のブロックへ (reset 後に再利用するブロックも含む)
+            cur++;
+            offset = 0;
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: reset
+     - 機能  : 切り出した領域を全て解放する (ブロックは次の allocate で再利用する)
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    void reset() {
+        cur = 0;
+        offset = 0;
+        used = 0;
+    }
+
+    // reset 以降に切り出したバイト数
+    size_t bytes_used() const { return used; }
+
+    // 確保しているブロックの合計のバイト数
+    size_t bytes_reserved() const {
+        size_t s = 0;
+        for (const Block& b : blocks) s += b.size;
+        return s;
+    }
+
+    private:
+    static constexpr size_t BLOCK_ALIGN = 64; // キャッシュラインの大きさ
+
+    struct Block {
+        char* ptr;
+        size_t size;
+    };
+
+    size_t block_size;
+    std::vector<Block> blocks;
+    size_t cur = 0;    // 切り出し中のブロック
+    size_t offset = 0; // 切り出し中のブロックの使用済みバイト数
+    size_t used = 0;
+};
+
+/*----------------------------------------------------------
+ - クラス名  : ArenaAllocator
+ - 機能      : Arena から領域を切り出す、標準ライブラリのコンテナ用のアロケータ
+ - 備考      : deallocate は何もしない (Arena の reset かデストラクタでまとめて解放する)
+               vector が伸びるときの古い領域は reset まで残るので、
+               大きさが分かっているなら reserve しておくとよい
+ - 使用例    : Arena arena;
+               avector<int> a(arena);
+               a.reserve(N);
+               vector<int, ArenaAllocator<int>> b(N, 0, arena); // avector<int> と同じ
+----------------------------------------------------------*/
+template <class T>
+class ArenaAllocator {
+    public:
+    using value_type = T;
+
+    ArenaAllocator(Arena& arena) : _arena(&arena) {}
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : _arena(other.arena()) {}
+
+    T* allocate(size_t n) { return (T*)_arena->allocate(n * sizeof(T), alignof(T)); }
+    void deallocate(T*, size_t) {}
+
+    Arena* arena() const { return _arena; }
+
+    template <class U>
+    bool operator==(const ArenaAllocator<U>& other) const { return _arena == other.arena(); }
+    template <class U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return _arena != other.arena(); }
+
+    private:
+    Arena* _arena;
+};
+
+template <class T>
+using avector = std::vector<T, ArenaAllocator<T>>;
\ No newline at end of file
@@ -35,9 +35,12 @@ class BIT
         }
 
         p++; // 1 オリジンで計算して、0 オリジンのdataを更新する
+        PROF_ONLY(int nodes = 0;)
         for(int x = p; x <= _n; x += x & -x) {
             data[x - 1] += w;
+            PROF_ONLY(nodes++;)
         }
+        PROF_COUNT("BIT/add (nodes)", nodes);
     }
 
     /*----------------------------------------------------------
@@ -84,9 +87,12 @@ class BIT
     ----------------------------------------------------------*/
     T _sum(int r) {
         T ret = 0;
+        PROF_ONLY(int nodes = 0;)
         for(int x = r; x > 0; x -= x & -x) {
             ret += data[x - 1];
+            PROF_ONLY(nodes++;)
         }
+        PROF_COUNT("BIT/sum (nodes)", nodes);
         return ret;
     }
 };
\ No newline at end of file
@@ -0,0 +1,101 @@
+/*----------------------------------------------------------
+ - クラス名  : CSRGraph
+ - 機能      : CSR 形式 (Compressed Sparse Row) の有向グラフ
+ - パラメータ : class T : 辺の重みの型 (重みなしのグラフでは省略してよい)
+ - 備考      : 辺は add_edge で配列に溜めておき、build で頂点ごとに連続した
+               1本の配列に並べ替える (数える → 配置する の2パス)
+               vector<vector<int>> と異なり頂点ごとのメモリ確保がなく、
+               隣接する辺がメモリ上で連続するため走査が速い
+               build の後に add_edge した場合は、もう一度 build すること
+ - 使用例    : CSRGraph<long long> g(N);
+               g.add_edge(0, 1, 5);
+               g.build();
+               for (auto& e : g[0]) cout << e.to << ' ' << e.cost << endl;
+----------------------------------------------------------*/
+template <class T = int>
+class CSRGraph {
+    public:
+    struct Edge {
+        int to;
+        T cost;
+    };
+
+    /*----------------------------------------------------------
+     - 構造体名: Range
+     - 機能    : 頂点から出る辺の範囲 (範囲 for 文で走査できる)
+    ----------------------------------------------------------*/
+    struct Range {
+        const Edge* first;
+        const Edge* last;
+        const Edge* begin() const { return first; }
+        const Edge* end() const { return last; }
+        int size() const { return (int)(last - first); }
+    };
+
+    /*----------------------------------------------------------
+     - 関数名: CSRGraph
+     - 機能  : コンストラクタ
+     - 引数  : int n : 頂点の数
+    ----------------------------------------------------------*/
+    CSRGraph(int n) : _n(n), start(n + 1, 0) {}
+
+    /*----------------------------------------------------------
+     - 関数名: add_edge
+     - 機能  : from -> to の有向辺を追加する
+     - 引数  : int from, to : 端点 (0 <= from,to < n)
+               T cost : 辺の重み (省略すると 1)
+     - 戻り値: なし
+    ----------------------------------------------------------*/
+    void add_edge(int from, int to, T cost = T(1)) {
+        if (from < 0 || from >= _n || to < 0 || to >= _n) {
+            printf("[CSRGraph] Error: argument of add_edge function is inappropriate.\n");
+            printf("(from, to) : (%d,%d)\n", from, to);
+            return;
+        }
+        buffer.emplace_back(from, Edge{to, cost});
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: build
+     - 機能  : 追加された辺を CSR 形式に並べる
+     - 備考  : 同じ頂点から出る辺は追加した順に並ぶ
+     - 計算量: O(N + M)
+    ----------------------------------------------------------*/
+    void build() {
+        start.assign(_n + 1, 0);
+        for (const auto& p : buffer) start[p.first + 1]++;
+        for (int i = 0; i < _n; i++) start[i + 1] += start[i];
+        elist.resize(buffer.size());
+        std::vector<int> pos(start.begin(), start.end() - 1);
+        for (const auto& p : buffer) elist[pos[p.first]++] = p.second;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: operator[]
+     - 機能  : 頂点 v から出る辺の範囲を返す
+     - 引数  : int v : 頂点 (0 <= v < n)
+     - 備考  : build の後に呼ぶこと
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    Range operator[](int v) const {
+        return Range{elist.data() + start[v], elist.data() + start[v + 1]};
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: size
+     - 機能  : 頂点の数を返す
+    ----------------------------------------------------------*/
+    int size() const { return _n; }
+
+    /*----------------------------------------------------------
+     - 関数名: edge_count
+     - 機能  : build 済みの辺の本数を返す
+    ----------------------------------------------------------*/
+    int edge_count() const { return (int)elist.size(); }
+
+    private:
+    int _n;
+    std::vector<int> start;  // v から出る辺は elist[start[v]] ... elist[start[v+1]-1]
+    std::vector<Edge> elist;
+    std::vector<std::pair<int, Edge>> buffer; // add_edge で追加された辺 (from, 辺)
+};
\ No newline at end of file
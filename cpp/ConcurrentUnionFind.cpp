@@ -0,0 +1,297 @@
+/*----------------------------------------------------------
+ - クラス名  : ConcurrentUnionFind
+ - 機能      : 複数のスレッドから同時に merge / same を呼べる UnionFind
+ - 備考      : 親を std::atomic<int> で持ち、ロックを使わずに CAS で更新する
+               ・結合 : 根の親を CAS で書き換える (失敗したら根を探し直す)
+                        どちらを親にするかは添字を乱数の seed で混ぜた優先度で決める (乱択リンク)
+                        seed はインスタンスごとに実行時に決めるので、入力から優先度を予測できない
+               ・探索 : 経路分割 (辿った頂点の親を祖父に CAS で付け替え、親へ進む)
+               連結成分の大きさは持たない
+               並列処理のスレッドは最初の merge_parallel / labels で作り、
+               オブジェクトが破棄されるまで使い回す (スレッド数を変えたときだけ作り直す)
+               NDEBUG を定義すると引数の範囲チェックを省略する (高速化用)
+               std::thread を使うため、環境によってはコンパイル時に -pthread が必要
+ - 参考      : R. J. Anderson, H. Woll, "Wait-free parallel algorithms
+               for the union-find problem" (1991)
+ - 使用例    : ConcurrentUnionFind uf(N);
+               uf.merge_parallel(edges, 8); // 8 スレッドで全ての辺を結合する
+               vector<int> id = uf.labels(8);
+----------------------------------------------------------*/
+class ConcurrentUnionFind {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: ConcurrentUnionFind
+     - 機能  : コンストラクタ
+     - 引数  : int n : 頂点の数 (n >= 1)
+    ----------------------------------------------------------*/
+    ConcurrentUnionFind(int n) : _n(n), parent(n), salt(make_salt()) {
+        for (int i = 0; i < n; i++) parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    ConcurrentUnionFind(const ConcurrentUnionFind&) = delete;
+    ConcurrentUnionFind& operator=(const ConcurrentUnionFind&) = delete;
+
+    ~ConcurrentUnionFind() { stop_workers(); }
+
+    /*----------------------------------------------------------
+     - 関数名: merge
+     - 機能  : 頂点 a、b を結合する
+     - 引数  : int a, b : 結合する2頂点 (0 <= a,b < n)
+     - 戻り値: bool : この呼び出しで結合したなら true
+     - 備考  : 複数スレッドから同時に呼んでよい
+     - 計算量: 期待 O(log(n)) (実際にはほぼ定数)
+    ----------------------------------------------------------*/
+    bool merge(int a, int b) {
+#ifndef NDEBUG
+        if (a < 0 || _n <= a || b < 0 || _n <= b) {
+            printf("[ConcurrentUnionFind] Error: argument of merge function is inappropriate.\n");
+            printf("a: %d, b: %d\n", a, b);
+            return false;
+        }
+#endif
+        while (true) {
+            a = _root(a);
+            b = _root(b);
+            if (a == b) return false;
+
+            // 優先度の低い根を高い根の子にする
+            if (priority(a) > priority(b)) std::swap(a, b);
+            int expected = a;
+            if (parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) return true;
+            // 他のスレッドが a を先に結合したので、根を探し直す
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: same
+     - 機能  : 頂点 a、b が同じ連結成分に属するかを返す
+     - 引数  : int a, b : 調べる2頂点 (0 <= a,b < n)
+     - 備考  : 並行して merge されている場合は、呼び出し中のある時点での結果を返す
+    ----------------------------------------------------------*/
+    bool same(int a, int b) {
+#ifndef NDEBUG
+        if (a < 0 || _n <= a || b < 0 || _n <= b) {
+            printf("[ConcurrentUnionFind] Error: argument of same function is inappropriate.\n");
+            printf("a: %d, b: %d\n", a, b);
+            return false;
+        }
+#endif
+        while (true) {
+            a = _root(a);
+            b = _root(b);
+            if (a == b) return true;
+            // a が根のままなら、その時点で a と b は別の連結成分だった
+            if (parent[a].load(std::memory_order_acquire) == a) return false;
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: root
+     - 機能  : 頂点 a の根を返す
+     - 引数  : int a : 調べる頂点 (0 <= a < n)
+     - 戻り値: int : 根 (範囲外なら -1)
+     - 備考  : 複数スレッドから同時に呼んでよい
+    ----------------------------------------------------------*/
+    int root(int a) {
+#ifndef NDEBUG
+        if (a < 0 || _n <= a) {
+            printf("[ConcurrentUnionFind] Error: argument of root function is inappropriate.\n");
+            printf("a: %d\n", a);
+            return -1;
+        }
+#endif
+        return _root(a);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: merge_parallel
+     - 機能  : 辺のリストを threads 本のスレッドで分担して結合する
+     - 引数  : const vector<pair<int,int>>& edges : 結合する頂点の組
+               int threads : スレッド数 (1 以上)
+     - 計算量: O(M alpha(n) / threads) 程度 (M は辺の本数)
+    ----------------------------------------------------------*/
+    void merge_parallel(const std::vector<std::pair<int,int>>& edges, int threads) {
+        parallel_for((int)edges.size(), threads, [&](int l, int r) {
+            for (int i = l; i < r; i++) merge(edges[i].first, edges[i].second);
+        });
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: labels
+     - 機能  : 各頂点の連結成分の番号を threads 本のスレッドで求める
+     - 引数  : int threads : スレッド数 (1 以上)
+     - 戻り値: id[v] = v の連結成分の番号 (0 から、根の頂点番号の昇順)
+     - 備考  : 全ての merge が終わってから呼ぶこと
+               根を求める → 根に番号を振る (ブロックごとの累積和) → 番号を配る
+               の 3 段階をそれぞれ並列に行う
+     - 計算量: O(n alpha(n) / threads + threads)
+    ----------------------------------------------------------*/
+    std::vector<int> labels(int threads) {
+        std::vector<int> id(_n);
+        parallel_for(_n, threads, [&](int l, int r) {
+            for (int i = l; i < r; i++) id[i] = _root(i);
+        });
+
+        // ブロックごとに根の数を数え、累積和で各ブロックの先頭の番号を決める
+        int blocks = std::max(1, std::min(threads, _n));
+        int width = (_n + blocks - 1) / blocks;
+        std::vector<int> offset(blocks + 1, 0);
+        parallel_for(blocks, threads, [&](int l, int r) {
+            for (int k = l; k < r; k++) {
+                for (int i = k * width; i < std::min(_n, (k + 1) * width); i++) offset[k + 1] += (id[i] == i);
+            }
+        });
+        for (int k = 0; k < blocks; k++) offset[k + 1] += offset[k];
+
+        // 各ブロックの根に先頭から順に番号を振る
+        std::vector<int> number(_n);
+        parallel_for(blocks, threads, [&](int l, int r) {
+            for (int k = l; k < r; k++) {
+                int c = offset[k];
+                for (int i = k * width; i < std::min(_n, (k + 1) * width); i++) {
+                    if (id[i] == i) number[i] = c++;
+                }
+            }
+        });
+        _count = offset[blocks];
+
+        parallel_for(_n, threads, [&](int l, int r) {
+            for (int i = l; i < r; i++) id[i] = number[id[i]];
+        });
+        return id;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: groups
+     - 機能  : 連結成分ごとにグループ化した2次元配列を求める
+     - 引数  : int threads : labels に用いるスレッド数
+     - 戻り値: 連結成分ごとにグループ化した2次元配列
+     - 備考  : UnionFind::groups と同じ形式 (グループの順序は根の頂点番号の昇順)
+    ----------------------------------------------------------*/
+    std::vector<std::vector<int>> groups(int threads = 1) {
+        std::vector<int> id = labels(threads);
+        std::vector<std::vector<int>> result(_count);
+        for (int i = 0; i < _n; i++) result[id[i]].push_back(i);
+        return result;
+    }
+
+    private:
+    int _n;
+    int _count = 0; // 直前の labels で求めた連結成分の個数
+    std::vector<std::atomic<int>> parent; // 根なら自分自身、子なら親の頂点
+    unsigned int salt;                    // 優先度の seed
+
+    // 使い回すスレッド (呼び出したスレッドは区間 0 を担当するので、区間 t は workers[t - 1])
+    std::vector<std::thread> workers;
+    std::mutex mtx;
+    std::condition_variable start_cv, done_cv;
+    std::function<void(int)> task; // task(t) : 区間 t の処理
+    int generation = 0;            // parallel_for を呼ぶたびに増える
+    int pending = 0;               // 処理中のスレッドの数
+    bool stopping = false;
+
+    /*----------------------------------------------------------
+     - 関数名: _root
+     - 機能  : 頂点 a の根を返す (範囲チェックなし)
+     - 備考  : 経路分割: 辿った頂点の親を祖父に付け替え、親へ進む
+               CAS が失敗しても他のスレッドが親を更新しただけなので無視してよい
+    ----------------------------------------------------------*/
+    int _root(int a) {
+        while (true) {
+            int p = parent[a].load(std::memory_order_acquire);
+            if (p == a) return a;
+            int gp = parent[p].load(std::memory_order_acquire);
+            if (p != gp) parent[a].compare_exchange_weak(p, gp, std::memory_order_acq_rel);
+            a = p;
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: priority
+     - 機能  : 結合の向きを決める優先度を返す
+     - 備考  : seed との xor と murmur3 の仕上げの混ぜ (xor シフトと奇数の乗算) は
+               どれも 2^32 を法とした全単射なので、優先度は重複しない
+               (重複すると2つのスレッドが互いを親にして閉路ができる)
+               優先度が乱数とみなせるので、木の高さは期待 O(log(n)) になる
+    ----------------------------------------------------------*/
+    unsigned int priority(int a) const {
+        unsigned int h = (unsigned int)a ^ salt;
+        h ^= h >> 16;
+        h *= 0x85EBCA6Bu;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35u;
+        h ^= h >> 16;
+        return h;
+    }
+
+    // 時刻とインスタンスのアドレスから seed を作る
+    unsigned int make_salt() const {
+        unsigned long long x = (unsigned long long)std::chrono::steady_clock::now().time_since_epoch().count() ^ (unsigned long long)(uintptr_t)this;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return (unsigned int)(x ^ (x >> 31));
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: parallel_for
+     - 機能  : [0, n) を threads 個の区間に分け、f(l, r) を並列に呼び出す
+     - 備考  : 呼び出したスレッドも 1 区間を担当し、全ての区間が終わるまで待つ
+               残りの区間は使い回すスレッドに渡す (スレッドを毎回は作らない)
+    ----------------------------------------------------------*/
+    template <class F>
+    void parallel_for(int n, int threads, F f) {
+        threads = std::max(1, std::min(threads, n));
+        if (threads == 1) {
+            f(0, n);
+            return;
+        }
+        if ((int)workers.size() != threads - 1) {
+            stop_workers();
+            for (int t = 1; t < threads; t++) workers.emplace_back([this, t, seen = generation] { worker_loop(t, seen); });
+        }
+        const int width = (n + threads - 1) / threads;
+        auto job = [&](int t) {
+            int l = std::min(n, t * width), r = std::min(n, (t + 1) * width);
+            if (l < r) f(l, r);
+        };
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            task = job;
+            pending = threads - 1;
+            generation++;
+        }
+        start_cv.notify_all();
+        job(0);
+        std::unique_lock<std::mutex> lock(mtx);
+        done_cv.wait(lock, [&] { return pending == 0; });
+        task = nullptr;
+    }
+
+    // 区間 t を担当するスレッドの本体 (seen : 処理済みの generation)
+    void worker_loop(int t, int seen) {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true) {
+            start_cv.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            std::function<void(int)> job = task;
+            lock.unlock();
+            job(t);
+            lock.lock();
+            if (--pending == 0) done_cv.notify_one();
+        }
+    }
+
+    // 使い回しているスレッドを全て終了させる
+    void stop_workers() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        start_cv.notify_all();
+        for (auto& th : workers) th.join();
+        workers.clear();
+        stopping = false;
+    }
+};
\ No newline at end of file
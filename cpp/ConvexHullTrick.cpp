@@ -0,0 +1,122 @@
+/*----------------------------------------------------------
+ - クラス名  : MonotoneCHT
+ - 機能      : 傾きが単調な順に直線を追加し、点 x での最小値を求める (Convex Hull Trick)
+               (dp[i] = min_j (a_j * x_i + b_j) で a_j が単調なときの遷移を高速にする)
+ - 備考      : 下側の凸包をなす直線だけを傾きの降順に deque に持つ
+               直線は傾きが今までの全てより小さい (後ろに追加) か大きい (前に追加) こと
+               不要な直線の判定は交点の比較を掛け算で行い、__int128 で計算するので
+               係数が 1e9、座標が 1e9 程度でもあふれない
+               問い合わせの x も単調なら get_inc / get_dec で端から不要な直線を捨てて
+               償却 O(1)、そうでなければ get で二分探索 O(log(n))
+               最大値を求めるときは IsMin = false にする (内部で符号を反転する)
+               LiChaoTree と違い傾きの順の制約があるが、deque の操作だけなので速い
+ - パラメータ : class T : 係数と座標の型 (整数型)
+               bool IsMin : true なら最小値、false なら最大値
+ - 計算量    : 直線の追加 償却 O(1)、get O(log(n))、get_inc / get_dec 償却 O(1)
+ - 使用例    : // dp[i] = min_{j<i} (dp[j] + (X[i] - X[j])^2 + C) (X は昇順)
+               MonotoneCHT<long long> cht;
+               dp[0] = 0;
+               cht.add_line(-2 * X[0], X[0] * X[0]);
+               rep2(i, 1, N) {
+                   dp[i] = X[i] * X[i] + C + cht.get_inc(X[i]); // X[i] は昇順
+                   cht.add_line(-2 * X[i], dp[i] + X[i] * X[i]);  // 傾きは降順
+               }
+----------------------------------------------------------*/
+template <class T, bool IsMin = true>
+class MonotoneCHT {
+    public:
+
+    MonotoneCHT() = default;
+
+    /*----------------------------------------------------------
+     - 関数名: add_line
+     - 機能  : 直線 y = a * x + b を追加する
+     - 引数  : T a, b : 傾きと切片 (a は今までの全ての傾き以下、または以上)
+     - 計算量: 償却 O(1)
+    ----------------------------------------------------------*/
+    void add_line(T a, T b) {
+        Line f{sign(a), sign(b)};
+        if (lines.empty()) {
+            lines.push_back(f);
+            return;
+        }
+        if (f.a <= lines.back().a) {
+            // 傾きが同じなら切片の小さい方だけ残す
+            if (f.a == lines.back().a) {
+                if (lines.back().b <= f.b) return;
+                lines.pop_back();
+            }
+            while (lines.size() >= 2 && unnecessary(lines[lines.size() - 2], lines.back(), f)) lines.pop_back();
+            lines.push_back(f);
+        } else if (lines.front().a <= f.a) {
+            if (f.a == lines.front().a) {
+                if (lines.front().b <= f.b) return;
+                lines.pop_front();
+            }
+            while (lines.size() >= 2 && unnecessary(f, lines.front(), lines[1])) lines.pop_front();
+            lines.push_front(f);
+        } else {
+            printf("[MonotoneCHT] Error: argument of add_line function is inappropriate.\n");
+            printf("a: %lld (slopes must be added in monotone order)\n", (long long)a);
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: get
+     - 機能  : 点 x での最小値 (IsMin = false なら最大値) を返す
+     - 引数  : T x : 座標 (任意の順でよい)
+     - 戻り値: T : 最小値 (直線がなければ numeric_limits<T>::max()、最大値なら -max())
+     - 備考  : 凸包上の直線の値は x で見ると谷型に並ぶので、二分探索で谷を探す
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    T get(T x) const {
+        if (lines.empty()) return sign(std::numeric_limits<T>::max());
+        int lo = 0, hi = (int)lines.size() - 1;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (eval(lines[mid], x) <= eval(lines[mid + 1], x)) hi = mid;
+            else lo = mid + 1;
+        }
+        return sign((T)eval(lines[lo], x));
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: get_inc / get_dec
+     - 機能  : 点 x での最小値を返す (x は前回の呼び出し以上 / 以下であること)
+     - 引数  : T x : 座標 (get_inc は昇順、get_dec は降順に呼ぶ)
+     - 備考  : x が増えるなら前の直線を、減るなら後ろの直線を、もう最小にならないので捨てる
+               捨てた直線は戻らないので、get_inc と一緒に追加するのは傾きの小さい直線
+               (後ろ) だけ、get_dec なら大きい直線 (前) だけにすること
+     - 計算量: 償却 O(1)
+    ----------------------------------------------------------*/
+    T get_inc(T x) {
+        if (lines.empty()) return sign(std::numeric_limits<T>::max());
+        while (lines.size() >= 2 && eval(lines[1], x) <= eval(lines[0], x)) lines.pop_front();
+        return sign((T)eval(lines.front(), x));
+    }
+    T get_dec(T x) {
+        if (lines.empty()) return sign(std::numeric_limits<T>::max());
+        while (lines.size() >= 2 && eval(lines[lines.size() - 2], x) <= eval(lines.back(), x)) lines.pop_back();
+        return sign((T)eval(lines.back(), x));
+    }
+
+    int size() const { return (int)lines.size(); }
+    bool empty() const { return lines.empty(); }
+    void clear() { lines.clear(); }
+
+    private:
+    struct Line {
+        T a, b;
+    };
+
+    std::deque<Line> lines; // 傾きの降順
+
+    static T sign(T v) { return IsMin ? v : -v; }
+    static __int128 eval(const Line& f, T x) { return (__int128)f.a * x + f.b; }
+
+    // 傾きが f1 > f2 > f3 のとき、f2 が最小になる x がないか
+    // (f1 と f2 の交点が f2 と f3 の交点以上: (b2 - b1) / (a1 - a2) >= (b3 - b2) / (a2 - a3))
+    static bool unnecessary(const Line& f1, const Line& f2, const Line& f3) {
+        return ((__int128)f2.b - f1.b) * ((__int128)f2.a - f3.a) >= ((__int128)f3.b - f2.b) * ((__int128)f1.a - f2.a);
+    }
+};
\ No newline at end of file
@@ -0,0 +1,189 @@
+/*----------------------------------------------------------
+ - クラス名  : RadixHeap
+ - 機能      : 取り出すキーが単調非減少である場合に使える優先度付きキュー
+ - パラメータ : class V : キーに付随させる値の型
+ - 条件      : push するキーは、最後に pop したキー以上であること
+ - 備考      : キーは 64bit 符号なし整数
+               最後に pop したキー last との xor の最上位ビットでバケットに分ける
+               pop でバケットを再配置するとき、各要素のバケット番号は必ず小さくなるので
+               1要素あたりの再配置は高々 64 回
+ - 計算量    : push O(1)、pop 償却 O(log(C)) (C はキーの最大値)
+ - 使用例    : RadixHeap<int> h;
+               h.push(3, 0);
+               auto [key, v] = h.pop();
+----------------------------------------------------------*/
+template <class V>
+class RadixHeap {
+    public:
+    using Key = unsigned long long;
+
+    bool empty() const { return _size == 0; }
+    int size() const { return _size; }
+
+    /*----------------------------------------------------------
+     - 関数名: push
+     - 機能  : キー key、値 v の要素を追加する
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    void push(Key key, const V& v) {
+        _size++;
+        buckets[bucket(key ^ last)].emplace_back(key, v);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: pop
+     - 機能  : キーが最小の要素を取り除いて返す
+     - 戻り値: (キー, 値)
+     - 備考  : 空のときに呼んではならない
+     - 計算量: 償却 O(log(C))
+    ----------------------------------------------------------*/
+    std::pair<Key, V> pop() {
+        if (buckets[0].empty()) {
+            int i = 1;
+            while (buckets[i].empty()) i++;
+
+            // バケット i の最小のキーを新しい last にして、要素を小さいバケットへ配り直す
+            Key new_last = buckets[i][0].first;
+            for (const auto& p : buckets[i]) new_last = std::min(new_last, p.first);
+            for (const auto& p : buckets[i]) buckets[bucket(p.first ^ new_last)].push_back(p);
+            buckets[i].clear();
+            last = new_last;
+        }
+        _size--;
+        std::pair<Key, V> result = buckets[0].back();
+        buckets[0].pop_back();
+        return result;
+    }
+
+    private:
+    int _size = 0;
+    Key last = 0; // 最後に pop したキー
+    std::array<std::vector<std::pair<Key, V>>, 65> buckets;
+
+    static int bucket(Key x) { return x == 0 ? 0 : 64 - __builtin_clzll(x); }
+};
+
+/*----------------------------------------------------------
+ - 関数名: dijkstra_radix
+ - 機能  : 始点 s から各頂点への最短距離を求める
+ - 引数  : const CSRGraph<T>& g : build 済みのグラフ (重みは 0 以上の整数)
+           int s : 始点
+ - 戻り値: 各頂点への最短距離 (到達できない頂点は numeric_limits<T>::max())
+ - 備考  : CSRGraph.cpp が必要
+           RadixHeap を用いるので、整数の重みに限る
+ - 計算量: O(M + N log(C)) (C は距離の最大値)
+ - 使用例: vector<long long> dist = dijkstra_radix(g, 0);
+----------------------------------------------------------*/
+template <class T>
+std::vector<T> dijkstra_radix(const CSRGraph<T>& g, int s) {
+    static_assert(std::is_integral<T>::value, "dijkstra_radix requires integer costs");
+    const T inf = std::numeric_limits<T>::max();
+    std::vector<T> dist(g.size(), inf);
+    if (s < 0 || (int)g.size() <= s) {
+        printf("[dijkstra_radix] Error: argument of dijkstra_radix function is inappropriate.\n");
+        printf("s: %d\n", s);
+        return dist;
+    }
+    RadixHeap<int> heap;
+    dist[s] = 0;
+    heap.push(0, s);
+    while (!heap.empty()) {
+        auto [d, v] = heap.pop();
+        if ((T)d != dist[v]) continue; // 既に短い距離で確定している
+        for (const auto& e : g[v]) {
+            T nd = dist[v] + e.cost;
+            if (nd < dist[e.to]) {
+                dist[e.to] = nd;
+                heap.push((unsigned long long)nd, e.to);
+            }
+        }
+    }
+    return dist;
+}
+
+/*----------------------------------------------------------
+ - 関数名: dijkstra_heap
+ - 機能  : 始点 s から各頂点への最短距離を求める
+ - 引数  : const CSRGraph<T>& g : build 済みのグラフ (重みは 0 以上)
+           int s : 始点
+ - 戻り値: 各頂点への最短距離 (到達できない頂点は numeric_limits<T>::max())
+ - 備考  : CSRGraph.cpp が必要
+           頂点の位置を覚えた二分ヒープで decrease-key を行うため、
+           ヒープの要素数は常に N 以下で、古い要素を読み飛ばす必要がない
+           重みが実数のときはこちらを使う
+           N = 1e6, M = 1e7 のランダムグラフ (g++ -O2) では、priority_queue と
+           vector<vector<pair>> による素朴な実装 2.24 s に対して 1.94 s (1.15 倍) で、
+           目標の 2 倍には届いていない (dijkstra_radix は 1.16 s で 1.93 倍、こちらも 2 倍未満)
+           整数の重みなら dijkstra_radix を使う
+ - 計算量: O((N + M) log(N))
+ - 使用例: vector<double> dist = dijkstra_heap(g, 0);
+----------------------------------------------------------*/
+template <class T>
+std::vector<T> dijkstra_heap(const CSRGraph<T>& g, int s) {
+    const int n = g.size();
+    const T inf = std::numeric_limits<T>::max();
+    std::vector<T> dist(n, inf);
+    if (s < 0 || n <= s) {
+        printf("[dijkstra_heap] Error: argument of dijkstra_heap function is inappropriate.\n");
+        printf("s: %d\n", s);
+        return dist;
+    }
+    std::vector<int> heap;         // 頂点を dist の小さい順に並べた二分ヒープ
+    std::vector<int> pos(n, -1);   // pos[v] = heap 内での v の位置 (-1 なら未追加、-2 なら確定済み)
+    heap.reserve(n);
+
+    // heap[i] を根の方向へ移動する
+    auto sift_up = [&](int i) {
+        int v = heap[i];
+        while (i > 0) {
+            int p = (i - 1) >> 1;
+            if (!(dist[v] < dist[heap[p]])) break;
+            heap[i] = heap[p];
+            pos[heap[i]] = i;
+            i = p;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    };
+
+    // heap[i] を葉の方向へ移動する
+    auto sift_down = [&](int i) {
+        int v = heap[i], sz = (int)heap.size();
+        while (true) {
+            int c = i * 2 + 1;
+            if (c >= sz) break;
+            if (c + 1 < sz && dist[heap[c + 1]] < dist[heap[c]]) c++;
+            if (!(dist[heap[c]] < dist[v])) break;
+            heap[i] = heap[c];
+            pos[heap[i]] = i;
+            i = c;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    };
+
+    dist[s] = 0;
+    heap.push_back(s);
+    pos[s] = 0;
+    while (!heap.empty()) {
+        int v = heap[0];
+        pos[v] = -2;
+        heap[0] = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) sift_down(0);
+
+        for (const auto& e : g[v]) {
+            if (pos[e.to] == -2) continue;
+            T nd = dist[v] + e.cost;
+            if (!(nd < dist[e.to])) continue;
+            dist[e.to] = nd;
+            if (pos[e.to] == -1) {
+                heap.push_back(e.to);
+                sift_up((int)heap.size() - 1);
+            } else {
+                sift_up(pos[e.to]); // decrease-key
+            }
+        }
+    }
+    return dist;
+}
\ No newline at end of file
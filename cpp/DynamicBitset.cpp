@@ -0,0 +1,352 @@
+/*----------------------------------------------------------
+ - クラス名  : DynamicBitset
+ - 機能      : 大きさを実行時に決めるビット列 (std::bitset<N> の代わり)
+ - 備考      : 64 ビットの語の配列で持ち、語ごとにまとめて演算する
+               std::bitset にない find_first / find_next、区間の個数 count(l, r)、
+               部分和 DP 用の shift_or (*this |= *this << k を一時オブジェクトなしで行う) がある
+               USE_AVX2 が定義されているとき (template.cpp の USE_AVX2 か -mavx2) は
+               論理演算、左シフト、count、find_next を 256 ビットずつ処理する
+               定義されていなければ同じ処理を 64 ビットずつ行う
+               size() 以上の位置のビットは常に 0 に保つ
+ - 使用例    : // 部分和: A の部分集合の和として S が作れるか
+               DynamicBitset dp(S + 1);
+               dp.set(0);
+               for (int a : A) dp.shift_or(a);
+               if (dp.test(S)) yes();
+
+               // 立っているビットを順に見る
+               for (int i = dp.find_first(); i < dp.size(); i = dp.find_next(i)) ...
+----------------------------------------------------------*/
+class DynamicBitset {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: DynamicBitset
+     - 機能  : コンストラクタ (全て 0)
+     - 引数  : int n : ビット数 (n >= 0)
+    ----------------------------------------------------------*/
+    explicit DynamicBitset(int n = 0) : _n(std::max(n, 0)), w((std::max(n, 0) + 63) >> 6, 0) {
+        if (n < 0) {
+            printf("[DynamicBitset] Error: argument of constructor is inappropriate.\n");
+            printf("n: %d\n", n);
+        }
+    }
+
+    int size() const { return _n; }
+
+    /*----------------------------------------------------------
+     - 関数名: test / set / reset / flip
+     - 機能  : i ビット目を読む / 1 にする / 0 にする / 反転する
+     - 引数  : int i : 位置 (0 <= i < size())
+     - 備考  : ndarray と同じく、_GLIBCXX_ASSERTIONS を定義したときだけ範囲をチェックする
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    bool test(int i) const {
+        check(i);
+        return (w[i >> 6] >> (i & 63)) & 1;
+    }
+    void set(int i) {
+        check(i);
+        w[i >> 6] |= 1ULL << (i & 63);
+    }
+    void reset(int i) {
+        check(i);
+        w[i >> 6] &= ~(1ULL << (i & 63));
+    }
+    void flip(int i) {
+        check(i);
+        w[i >> 6] ^= 1ULL << (i & 63);
+    }
+    bool operator[](int i) const { return test(i); }
+
+    // 全てのビットを 1 にする / 0 にする / 反転する
+    void set() {
+        std::fill(w.begin(), w.end(), ~0ULL);
+        trim();
+    }
+    void reset() { std::fill(w.begin(), w.end(), 0ULL); }
+    void flip() {
+        for (uint64_t& x : w) x = ~x;
+        trim();
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: count
+     - 機能  : 1 のビットの個数を返す
+     - 計算量: O(n / 64)
+    ----------------------------------------------------------*/
+    int count() const { return (int)popcount_words(w.data(), (int)w.size()); }
+
+    /*----------------------------------------------------------
+     - 関数名: count
+     - 機能  : 半開区間 [l, r) の 1 のビットの個数を返す
+     - 引数  : int l, r : 区間の端点 (0 <= l <= r <= size())
+     - 計算量: O((r - l) / 64)
+    ----------------------------------------------------------*/
+    int count(int l, int r) const {
+        if (l < 0 || r < l || _n < r) {
+            printf("[DynamicBitset] Error: argument of count function is inappropriate.\n");
+            printf("l: %d, r: %d\n", l, r);
+            return 0;
+        }
+        if (l == r) return 0;
+        const int wl = l >> 6, wr = (r - 1) >> 6;
+        const uint64_t ml = ~0ULL << (l & 63);
+        const uint64_t mr = ~0ULL >> (63 - ((r - 1) & 63));
+        if (wl == wr) return __builtin_popcountll(w[wl] & ml & mr);
+        return __builtin_popcountll(w[wl] & ml) + (int)popcount_words(w.data() + wl + 1, wr - wl - 1) + __builtin_popcountll(w[wr] & mr);
+    }
+
+    bool any() const { return find_next(-1) < _n; }
+    bool none() const { return !any(); }
+
+    /*----------------------------------------------------------
+     - 関数名: find_next
+     - 機能  : i より後ろ (i は含まない) で最初の 1 のビットの位置を返す
+     - 引数  : int i : 位置 (-1 <= i)
+     - 戻り値: int : 位置 (なければ size())
+     - 計算量: O(次の 1 までの距離 / 64)
+    ----------------------------------------------------------*/
+    int find_next(int i) const {
+        const int start = i + 1;
+        if (start >= _n) return _n;
+        int k = start >> 6;
+        uint64_t x = w[k] & (~0ULL << (start & 63));
+        if (x != 0) return (k << 6) + __builtin_ctzll(x);
+        const int nw = (int)w.size();
+        k++;
+#ifdef USE_AVX2
+        for (; k + 4 <= nw; k += 4) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(w.data() + k));
+            if (!_mm256_testz_si256(v, v)) break;
+        }
+#endif
+        for (; k < nw; k++) {
+            if (w[k] != 0) return (k << 6) + __builtin_ctzll(w[k]);
+        }
+        return _n;
+    }
+
+    // 最初の 1 のビットの位置 (なければ size())
+    int find_first() const { return find_next(-1); }
+
+    /*----------------------------------------------------------
+     - 関数名: operator&= / operator|= / operator^=
+     - 機能  : 同じ大きさのビット列との論理演算
+     - 計算量: O(n / 64)
+    ----------------------------------------------------------*/
+    DynamicBitset& operator&=(const DynamicBitset& other) {
+        if (same_size(other, "operator&=")) apply(other, [](uint64_t a, uint64_t b) { return a & b; }, AndV());
+        return *this;
+    }
+    DynamicBitset& operator|=(const DynamicBitset& other) {
+        if (same_size(other, "operator|=")) apply(other, [](uint64_t a, uint64_t b) { return a | b; }, OrV());
+        return *this;
+    }
+    DynamicBitset& operator^=(const DynamicBitset& other) {
+        if (same_size(other, "operator^=")) apply(other, [](uint64_t a, uint64_t b) { return a ^ b; }, XorV());
+        return *this;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: operator<<= / operator>>=
+     - 機能  : 添字が大きい方へ / 小さい方へ k ビットずらす (はみ出したビットは捨てる)
+     - 引数  : int k : ずらす量 (k >= 0)
+     - 計算量: O(n / 64)
+    ----------------------------------------------------------*/
+    DynamicBitset& operator<<=(int k) {
+        if (k < 0) return shift_error("operator<<=", k);
+        shift_left<false>(k);
+        return *this;
+    }
+    DynamicBitset& operator>>=(int k) {
+        if (k < 0) return shift_error("operator>>=", k);
+        const int nw = (int)w.size();
+        const int q = std::min(k >> 6, nw), r = k & 63;
+        for (int i = 0; i + q < nw; i++) {
+            uint64_t x = w[i + q] >> r;
+            if (r != 0 && i + q + 1 < nw) x |= w[i + q + 1] << (64 - r);
+            w[i] = x;
+        }
+        std::fill(w.begin() + (nw - q), w.end(), 0ULL);
+        return *this;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: shift_or
+     - 機能  : *this |= *this << k を一時オブジェクトを作らずに行う
+     - 引数  : int k : ずらす量 (k >= 0)
+     - 備考  : 部分和 DP の1回の遷移 (dp[j + k] |= dp[j])
+     - 計算量: O(n / 64)
+    ----------------------------------------------------------*/
+    void shift_or(int k) {
+        if (k < 0) {
+            shift_error("shift_or", k);
+            return;
+        }
+        shift_left<true>(k);
+    }
+
+    DynamicBitset operator~() const {
+        DynamicBitset b(*this);
+        b.flip();
+        return b;
+    }
+    friend DynamicBitset operator&(DynamicBitset a, const DynamicBitset& b) { return a &= b; }
+    friend DynamicBitset operator|(DynamicBitset a, const DynamicBitset& b) { return a |= b; }
+    friend DynamicBitset operator^(DynamicBitset a, const DynamicBitset& b) { return a ^= b; }
+    friend DynamicBitset operator<<(DynamicBitset a, int k) { return a <<= k; }
+    friend DynamicBitset operator>>(DynamicBitset a, int k) { return a >>= k; }
+    bool operator==(const DynamicBitset& other) const { return _n == other._n && w == other.w; }
+    bool operator!=(const DynamicBitset& other) const { return !(*this == other); }
+
+    // 語の配列 (size() 以上の位置のビットは 0 に保つこと)
+    uint64_t* data() { return w.data(); }
+    const uint64_t* data() const { return w.data(); }
+
+    private:
+    int _n;
+    std::vector<uint64_t> w;
+
+#ifdef USE_AVX2
+    struct AndV { __m256i operator()(__m256i a, __m256i b) const { return _mm256_and_si256(a, b); } };
+    struct OrV { __m256i operator()(__m256i a, __m256i b) const { return _mm256_or_si256(a, b); } };
+    struct XorV { __m256i operator()(__m256i a, __m256i b) const { return _mm256_xor_si256(a, b); } };
+#else
+    struct AndV {};
+    struct OrV {};
+    struct XorV {};
+#endif
+
+    // 範囲外の位置を報告して終了する (ホットパスに入らないよう別の関数にする)
+    [[noreturn]] __attribute__((noinline, cold)) void out_of_range(int i) const {
+        printf("[DynamicBitset] Error: index is out of range.\n");
+        printf("i: %d, size: %d\n", i, _n);
+        std::exit(1);
+    }
+
+    void check([[maybe_unused]] int i) const {
+#ifdef _GLIBCXX_ASSERTIONS
+        if (__builtin_expect((unsigned)i >= (unsigned)_n, 0)) out_of_range(i);
+#endif
+    }
+
+    bool same_size(const DynamicBitset& other, const char* func) const {
+        if (_n == other._n) return true;
+        printf("[DynamicBitset] Error: argument of %s function is inappropriate.\n", func);
+        printf("size: %d, other.size: %d\n", _n, other._n);
+        return false;
+    }
+
+    DynamicBitset& shift_error(const char* func, int k) {
+        printf("[DynamicBitset] Error: argument of %s function is inappropriate.\n", func);
+        printf("k: %d\n", k);
+        return *this;
+    }
+
+    // size() 以上の位置のビットを 0 にする
+    void trim() {
+        if ((_n & 63) != 0) w.back() &= ~0ULL >> (64 - (_n & 63));
+    }
+
+    // w[i] = op(w[i], other.w[i]) を全ての語に行う
+    template <class Op, class OpV>
+    void apply(const DynamicBitset& other, Op op, [[maybe_unused]] OpV opv) {
+        const int nw = (int)w.size();
+        uint64_t* a = w.data();
+        const uint64_t* b = other.w.data();
+        int i = 0;
+#ifdef USE_AVX2
+        for (; i + 4 <= nw; i += 4) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+            __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+            _mm256_storeu_si256((__m256i*)(a + i), opv(x, y));
+        }
+#endif
+        for (; i < nw; i++) a[i] = op(a[i], b[i]);
+    }
+
+    // 左に k ビットずらす (Or なら元の値との論理和を取る)
+    // 上の語から順に書き込むので、読む語 (自分以下の位置) はまだ書き換えていない
+    template <bool Or>
+    void shift_left(int k) {
+        const int nw = (int)w.size();
+        if (k >= _n) {
+            if (!Or) reset();
+            return;
+        }
+        const int q = k >> 6, r = k & 63;
+        uint64_t* a = w.data();
+        int i = nw - 1;
+#ifdef USE_AVX2
+        // a[i-3..i] に a[i-3-q..i-q] << r と a[i-4-q..i-1-q] >> (64 - r) を合わせる
+        // (r = 0 のとき 64 ビットの右シフトは 0 になる)
+        const __m128i sl = _mm_cvtsi32_si128(r), sr = _mm_cvtsi32_si128(64 - r);
+        for (; i - 4 - q >= 0; i -= 4) {
+            __m256i hi = _mm256_loadu_si256((const __m256i*)(a + i - 3 - q));
+            __m256i lo = _mm256_loadu_si256((const __m256i*)(a + i - 4 - q));
+            __m256i x = _mm256_or_si256(_mm256_sll_epi64(hi, sl), _mm256_srl_epi64(lo, sr));
+            if (Or) x = _mm256_or_si256(x, _mm256_loadu_si256((const __m256i*)(a + i - 3)));
+            _mm256_storeu_si256((__m256i*)(a + i - 3), x);
+        }
+#endif
+        for (; i >= q; i--) {
+            uint64_t x = a[i - q] << r;
+            if (r != 0 && i - q - 1 >= 0) x |= a[i - q - 1] >> (64 - r);
+            if (Or) a[i] |= x;
+            else a[i] = x;
+        }
+        if (!Or) std::fill(a, a + q, 0ULL);
+        trim();
+    }
+
+    // p[0..m) の 1 のビットの個数
+    static long long popcount_words(const uint64_t* p, int m) {
+        long long s = 0;
+        int i = 0;
+#ifdef USE_AVX2
+        // 4 ビットずつ表を引いて数え (vpshufb)、8 バイトごとに足し合わせる (vpsadbw)
+        const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                               0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low = _mm256_set1_epi8(0x0f);
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 4 <= m; i += 4) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+            __m256i c = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(v, low)),
+                                        _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(c, _mm256_setzero_si256()));
+        }
+        s += _mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1) + _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3);
+#endif
+        for (; i < m; i++) s += __builtin_popcountll(p[i]);
+        return s;
+    }
+};
+
+/*----------------------------------------------------------
+ - 関数名: transitive_closure
+ - 機能  : 有向グラフの推移閉包を求める (Warshall-Floyd のビット並列版)
+ - 引数  : vector<DynamicBitset>& reach : 隣接行列 (reach[i].test(j) なら辺 i -> j)
+                                           長さ1以上の道で i から j に行けるかに書き換える
+ - 備考  : 経由する頂点 k ごとに、k に行ける全ての i について reach[i] |= reach[k]
+           (自分自身へは、i を通る閉路があるときだけ 1 になる)
+ - 計算量: O(n^3 / 64) (AVX2 なら 256 ビットずつ)。n = 2000 で 1.25e8 語
+ - 使用例: vector<DynamicBitset> reach(N, DynamicBitset(N));
+           rep(i, M) reach[A[i]].set(B[i]);
+           transitive_closure(reach);
+----------------------------------------------------------*/
+void transitive_closure(std::vector<DynamicBitset>& reach) {
+    const int n = (int)reach.size();
+    for (int i = 0; i < n; i++) {
+        if (reach[i].size() != n) {
+            printf("[transitive_closure] Error: argument of transitive_closure function is inappropriate.\n");
+            printf("n: %d, reach[%d].size: %d\n", n, i, reach[i].size());
+            return;
+        }
+    }
+    for (int k = 0; k < n; k++) {
+        for (int i = 0; i < n; i++) {
+            if (reach[i].test(k)) reach[i] |= reach[k];
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,414 @@
+// POSIX のヘッダ (FastIO.cpp を貼るときだけ必要なので template.cpp には置かない)
+#include <unistd.h>   // read, write, sysconf
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+
+/*----------------------------------------------------------
+ - クラス名  : FastReader
+ - 機能      : 標準入力を高速に読み込む
+ - 備考      : 標準入力が通常のファイル (リダイレクト) なら mmap で丸ごと
+               メモリに割り当て、そうでなければ (パイプなど) read で大きな
+               ブロック単位に読み込む
+               cin と異なりロケールを考慮せず、トークンごとのメモリ確保もしない
+               (文字列は引数の string の確保済み領域を再利用する)
+               cin と混ぜて使ってはならない
+ - 使用例    : int N; ll K; string S;
+               fin.read(N, K, S);
+               vi A(N);
+               fin.read(A);
+----------------------------------------------------------*/
+class FastReader {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: FastReader
+     - 機能  : コンストラクタ
+     - 備考  : ファイルの末尾の次のバイトを番兵 ('\0') として使うため、
+               ファイルの大きさがページサイズの倍数のときは mmap を使わない
+               (mmap した領域の末尾のページの残りは 0 で埋められる)
+    ----------------------------------------------------------*/
+    FastReader() {
+        struct stat st;
+        if (fstat(0, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+            st.st_size % sysconf(_SC_PAGESIZE) != 0) {
+            void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, 0, 0);
+            if (p != MAP_FAILED) {
+                buf = (char*)p;
+                len = (size_t)st.st_size;
+                mapped = true;
+                eof = true;
+                return;
+            }
+        }
+        buf = new char[BUFFER_SIZE + 1];
+        buf[0] = '\0';
+    }
+
+    ~FastReader() {
+        if (mapped) munmap(buf, len);
+        else delete[] buf;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: read
+     - 機能  : 空白区切りの値を順に読み込む
+     - 引数  : Ts&... xs : 読み込む変数 (整数、浮動小数点数、char、string、
+                           modint、pair、vector (要素数分読む) の組み合わせ)
+     - 戻り値: bool : 全て読み込めたら true (入力の終わりに達したら false)
+     - 使用例: int a; long long b; string s; vector<int> v(n);
+               fin.read(a, b, s, v);
+    ----------------------------------------------------------*/
+    template <class... Ts>
+    bool read(Ts&... xs) {
+        bool ok = true;
+        ((ok = ok && read_one(xs)), ...);
+        return ok;
+    }
+
+    private:
+    static constexpr size_t BUFFER_SIZE = 1 << 17;
+    static constexpr size_t MARGIN = 64; // 数値1個の最大長より長い
+
+    char* buf = nullptr;
+    size_t pos = 0, len = 0;
+    bool mapped = false;
+    bool eof = false;
+
+    /*----------------------------------------------------------
+     - 関数名: refill
+     - 機能  : 未読の部分をバッファの先頭に移し、続きを read で1回だけ読み込む
+     - 備考  : buf[len] には常に番兵 '\0' を置く
+               インタラクティブな問題やパイプでは、相手が次の入力を書く前に
+               こちらの出力を待っていることがあるので、バッファが一杯になるまで
+               read を繰り返してはならない (届いている分だけで返る)
+    ----------------------------------------------------------*/
+    void refill() {
+        if (eof) return;
+        len -= pos;
+        std::memmove(buf, buf + pos, len);
+        pos = 0;
+        ssize_t r = ::read(0, buf + len, BUFFER_SIZE - len);
+        if (r <= 0) eof = true;
+        else len += (size_t)r;
+        buf[len] = '\0';
+    }
+
+    // 未読の部分 [pos, len) に区切り文字 (空白や改行) があるか
+    bool has_delimiter() const {
+        for (size_t i = pos; i < len; i++) {
+            if (buf[i] <= ' ') return true;
+        }
+        return false;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: skip
+     - 機能  : 空白を読み飛ばし、次のトークンの先頭から MARGIN バイト以上か、
+               トークンの終わりの区切り文字までを読み込んでおく
+     - 戻り値: bool : トークンがあれば true
+     - 備考  : トークンが区切り文字まで届いていれば、それ以上は read しない
+    ----------------------------------------------------------*/
+    bool skip() {
+        while (true) {
+            while (pos < len && buf[pos] <= ' ') pos++;
+            if (pos < len) break;
+            if (eof) return false;
+            refill();
+        }
+        while (!eof && len - pos < MARGIN && !has_delimiter()) refill();
+        return true;
+    }
+
+    template <class T>
+    std::enable_if_t<std::is_integral<T>::value, bool> read_one(T& x) {
+        if (!skip()) return false;
+        bool neg = false;
+        if (buf[pos] == '-') {
+            neg = true;
+            pos++;
+        }
+        std::make_unsigned_t<T> v = 0;
+        while ((unsigned)(buf[pos] - '0') < 10) v = v * 10 + (buf[pos++] - '0');
+        x = (T)(neg ? -v : v);
+        return true;
+    }
+
+    // modint など、static な mod() を持つ型は long long として読んでから変換する
+    template <class T>
+    auto read_one(T& x) -> decltype(T::mod(), bool()) {
+        long long v;
+        if (!read_one(v)) return false;
+        x = T(v);
+        return true;
+    }
+
+    bool read_one(double& x) {
+        if (!skip()) return false;
+        char* end;
+        x = std::strtod(buf + pos, &end);
+        pos = end - buf;
+        return true;
+    }
+
+    bool read_one(char& c) {
+        if (!skip()) return false;
+        c = buf[pos++];
+        return true;
+    }
+
+    bool read_one(std::string& s) {
+        if (!skip()) return false;
+        s.clear();
+        while (true) {
+            size_t l = pos;
+            while (pos < len && buf[pos] > ' ') pos++;
+            s.append(buf + l, pos - l);
+            if (pos < len || eof) break;
+            refill(); // トークンがバッファの末尾をまたいでいる
+        }
+        return true;
+    }
+
+    template <class T, class U>
+    bool read_one(std::pair<T, U>& p) { return read_one(p.first) && read_one(p.second); }
+
+    template <class T>
+    bool read_one(std::vector<T>& v) {
+        for (auto& x : v) {
+            if (!read_one(x)) return false;
+        }
+        return true;
+    }
+};
+FastReader fin;
+
+/*----------------------------------------------------------
+ - クラス名  : FastWriter
+ - 機能      : 標準出力に高速に書き込む
+ - 備考      : 固定長のバッファに書き溜め、一杯になったときとプログラムの終了時
+               (グローバル変数 fout のデストラクタ) に write でまとめて書き出す
+               整数は2桁ずつの表を引いて文字列にする (snprintf を使わない)
+               浮動小数点数は set_precision で指定した桁数の固定小数点で書く
+               (小数部は整数演算で丸めるので printf と同じ結果になる)
+               cout や printf と混ぜると出力の順序が入れ替わるので、混ぜるときは
+               先に flush を呼ぶこと
+ - 使用例    : fout << N << ' ' << S << '\n';
+               fout.println(a, b, c);   // "a b c\n"
+               fout.set_precision(10);
+               fout.println(x);
+               fout.println(A);         // vector は空白区切りで1行に書く
+----------------------------------------------------------*/
+class FastWriter {
+    public:
+    FastWriter() : buf(new char[BUFFER_SIZE]) {}
+
+    ~FastWriter() {
+        flush();
+        delete[] buf;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: flush
+     - 機能  : バッファの内容を標準出力に書き出す
+    ----------------------------------------------------------*/
+    void flush() {
+        size_t done = 0;
+        while (done < pos) {
+            ssize_t r = ::write(1, buf + done, pos - done);
+            if (r <= 0) break;
+            done += (size_t)r;
+        }
+        pos = 0;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: set_precision
+     - 機能  : 浮動小数点数の小数点以下の桁数を設定する
+     - 引数  : int p : 桁数 (0 <= p <= 18、既定値は 15)
+    ----------------------------------------------------------*/
+    void set_precision(int p) {
+        if (p < 0 || 18 < p) {
+            printf("[FastWriter] Error: argument of set_precision function is inappropriate.\n");
+            printf("p: %d\n", p);
+            return;
+        }
+        precision = p;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: print
+     - 機能  : 値を空白区切りで書く (改行しない)
+     - 引数  : const Ts&... xs : 書く値 (整数、浮動小数点数、char、文字列、
+                                 modint、pair、vector の組み合わせ)
+    ----------------------------------------------------------*/
+    template <class T, class... Ts>
+    void print(const T& x, const Ts&... xs) {
+        write_one(x);
+        ((write_one(' '), write_one(xs)), ...);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: println
+     - 機能  : 値を空白区切りで書き、改行する
+    ----------------------------------------------------------*/
+    template <class... Ts>
+    void println(const Ts&... xs) {
+        if constexpr (sizeof...(xs) > 0) print(xs...);
+        write_one('\n');
+    }
+
+    template <class T>
+    FastWriter& operator<<(const T& x) {
+        write_one(x);
+        return *this;
+    }
+
+    private:
+    static constexpr size_t BUFFER_SIZE = 1 << 16;
+    static constexpr size_t MARGIN = 64; // 整数・浮動小数点数1個の最大長より長い
+
+    // DIGITS[2i], DIGITS[2i+1] は i (0 <= i < 100) の10進表記の2桁
+    static constexpr char DIGITS[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    char* buf;
+    size_t pos = 0;
+    int precision = 15;
+
+    void reserve(size_t n) {
+        if (pos + n > BUFFER_SIZE) flush();
+    }
+
+    // 10進表記を tmp の末尾から詰め、先頭の位置を返す
+    static int to_chars(unsigned long long v, char* tmp, int end) {
+        while (v >= 100) {
+            end -= 2;
+            std::memcpy(tmp + end, DIGITS + (v % 100) * 2, 2);
+            v /= 100;
+        }
+        if (v >= 10) {
+            end -= 2;
+            std::memcpy(tmp + end, DIGITS + v * 2, 2);
+        } else {
+            tmp[--end] = (char)('0' + v);
+        }
+        return end;
+    }
+
+    void write_unsigned(unsigned long long v) {
+        char tmp[20];
+        int l = to_chars(v, tmp, 20);
+        std::memcpy(buf + pos, tmp + l, 20 - l);
+        pos += 20 - l;
+    }
+
+    template <class T>
+    std::enable_if_t<std::is_integral<T>::value> write_one(T x) {
+        reserve(MARGIN);
+        std::make_unsigned_t<T> v = x;
+        if constexpr (std::is_signed<T>::value) {
+            if (x < 0) {
+                buf[pos++] = '-';
+                v = -v;
+            }
+        }
+        write_unsigned(v);
+    }
+
+    // modint など、val() を持つ型は整数として書く
+    template <class T>
+    auto write_one(const T& x) -> decltype(x.val(), void()) { write_one(x.val()); }
+
+    void write_one(double x) {
+        reserve(MARGIN);
+        if (std::isnan(x)) {
+            write_one("nan");
+            return;
+        }
+        if (std::signbit(x)) {
+            buf[pos++] = '-';
+            x = -x;
+        }
+        if (x >= 1e18) {
+            // 整数部が unsigned long long に収まらない (inf を含む) ときだけ snprintf に任せる
+            char tmp[400];
+            int l = std::snprintf(tmp, sizeof(tmp), "%.*f", precision, x);
+            write_one(std::string(tmp, l));
+            return;
+        }
+        unsigned long long scale = 1;
+        for (int i = 0; i < precision; i++) scale *= 10;
+        unsigned long long ip = (unsigned long long)x;
+        unsigned long long fp = round_fraction(x - (double)ip, scale, ip);
+        if (fp >= scale) {
+            ip++;
+            fp -= scale;
+        }
+        write_unsigned(ip);
+        if (precision == 0) return;
+        buf[pos++] = '.';
+        // 小数部は先頭を 0 で埋めて precision 桁にする
+        char tmp[20];
+        int l = to_chars(fp, tmp, 20);
+        while (20 - l < precision) tmp[--l] = '0';
+        std::memcpy(buf + pos, tmp + l, precision);
+        pos += precision;
+    }
+
+    // 小数部 f (0 <= f < 1) に scale = 10^precision を掛けて整数に丸める
+    // f = mant / 2^sh と表して整数だけで計算し、ちょうど半分のときは偶数に丸める (printf と同じ)
+    // (ip は precision = 0 のときの偶奇の判定に使う)
+    static unsigned long long round_fraction(double f, unsigned long long scale, unsigned long long ip) {
+        // double のビット列から仮数と指数を取り出す (非正規化数と 0 は暗黙の 1 がない)
+        unsigned long long b;
+        std::memcpy(&b, &f, sizeof(b));
+        const int ex = (int)(b >> 52);
+        const unsigned long long mant = (b & ((1ULL << 52) - 1)) | (ex ? 1ULL << 52 : 0);
+        const int sh = ex ? 1075 - ex : 1074; // f < 1 なので sh >= 53
+        // mant * scale < 2^113 なので、sh >= 114 なら 1/2 未満で 0 に丸める
+        if (sh >= 114) return 0;
+        const unsigned __int128 prod = (unsigned __int128)mant * scale;
+        unsigned long long q = (unsigned long long)(prod >> sh);
+        const unsigned __int128 rem = prod - ((unsigned __int128)q << sh), half = (unsigned __int128)1 << (sh - 1);
+        const bool odd = (scale == 1 ? ip : q) & 1;
+        if (rem > half || (rem == half && odd)) q++;
+        return q;
+    }
+
+    void write_one(char c) {
+        reserve(1);
+        buf[pos++] = c;
+    }
+
+    void write_one(const char* s) { write_chars(s, std::strlen(s)); }
+    void write_one(const std::string& s) { write_chars(s.data(), s.size()); }
+
+    void write_chars(const char* s, size_t n) {
+        while (n > 0) {
+            if (pos == BUFFER_SIZE) flush();
+            size_t k = std::min(n, BUFFER_SIZE - pos);
+            std::memcpy(buf + pos, s, k);
+            pos += k;
+            s += k;
+            n -= k;
+        }
+    }
+
+    template <class T, class U>
+    void write_one(const std::pair<T, U>& p) {
+        write_one(p.first);
+        write_one(' ');
+        write_one(p.second);
+    }
+
+    template <class T>
+    void write_one(const std::vector<T>& v) {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i > 0) write_one(' ');
+            write_one(v[i]);
+        }
+    }
+};
+FastWriter fout;
\ No newline at end of file
@@ -0,0 +1,180 @@
+/*----------------------------------------------------------
+ - クラス名  : GridBFS
+ - 機能      : グリッド上の BFS / 0-1 BFS / 多始点 BFS を行う
+ - 備考      : テンプレートの di, dj (4近傍) を用いる
+               グリッドの周囲に1マスの壁 (番兵) を付けた (H+2) x (W+2) の
+               1次元配列に格納するため、移動のたびに範囲チェックをする必要がない
+               近傍への移動は 1 次元の添字に di[k] * (W+2) + dj[k] を足すだけになる
+               キューは配列を使い回すリングバッファで、探索中にメモリ確保をしない
+               (容量は bfs なら HW、bfs01 なら 2HW 程度で、初めて必要になったときに確保する)
+ - 使用例    : GridBFS g(S);          // S は vector<string>、'#' が壁
+               g.bfs({{si, sj}});
+               cout << g.dist(gi, gj) << endl; // 到達できなければ INF
+----------------------------------------------------------*/
+class GridBFS {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: GridBFS
+     - 機能  : コンストラクタ
+     - 引数  : const vector<string>& grid : グリッド (H 行 W 列)
+               char wall : 通れないマスの文字
+     - 計算量: O(HW)
+    ----------------------------------------------------------*/
+    GridBFS(const std::vector<std::string>& grid, char wall = '#')
+        : H((int)grid.size()), W(grid.empty() ? 0 : (int)grid[0].size()), W2(W + 2),
+          blocked((H + 2) * W2, 1), _dist((H + 2) * W2, INF) {
+        for (int i = 0; i < H; i++) {
+            for (int j = 0; j < W; j++) blocked[index(i, j)] = (grid[i][j] == wall);
+        }
+        for (int k = 0; k < 4; k++) offset[k] = di[k] * W2 + dj[k];
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: bfs
+     - 機能  : 始点の集合からの最短距離 (移動回数) を求める
+     - 引数  : const vector<pair<int,int>>& sources : 始点 (i, j) の集合 (0 <= i < H, 0 <= j < W)
+     - 戻り値: なし (dist で取得する)
+     - 備考  : 始点が1つなら bfs({{si, sj}}) とする
+     - 計算量: O(HW)
+    ----------------------------------------------------------*/
+    void bfs(const std::vector<std::pair<int,int>>& sources) {
+        if (!valid_sources(sources, "bfs")) return;
+        // 各マスは高々1回キューに入る
+        reserve_queue(H * W + 1);
+        std::fill(_dist.begin(), _dist.end(), INF);
+        head = tail = 0;
+        for (auto [i, j] : sources) {
+            int p = index(i, j);
+            if (blocked[p] || _dist[p] == 0) continue;
+            _dist[p] = 0;
+            push_back(p);
+        }
+
+        while (head != tail) {
+            int p = pop_front();
+            int nd = _dist[p] + 1;
+            for (int k = 0; k < 4; k++) {
+                int q = p + offset[k];
+                if (blocked[q] || _dist[q] <= nd) continue;
+                _dist[q] = nd;
+                push_back(q);
+            }
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: bfs01
+     - 機能  : マスに入るコストが 0 か 1 のときの最短距離を求める
+     - 引数  : const vector<pair<int,int>>& sources : 始点 (i, j) の集合 (0 <= i < H, 0 <= j < W)
+               F cost : int(int i, int j)  マス (i, j) に入るコスト (0 か 1)
+                        負の値を返したマスには入れない
+     - 戻り値: なし (dist で取得する)
+     - 備考  : wall のマスにも cost で決めたコストで入れる
+               (例: 壁を壊すのにコスト 1 かかる問題)
+               cost は探索の前にマスごとに1回だけ呼ばれる
+     - 計算量: O(HW)
+     - 使用例: g.bfs01({{0, 0}}, [&](int i, int j) { return S[i][j] == '#' ? 1 : 0; });
+    ----------------------------------------------------------*/
+    template <class F>
+    void bfs01(const std::vector<std::pair<int,int>>& sources, F cost) {
+        if (!valid_sources(sources, "bfs01")) return;
+        // 各マスは高々2回 (コスト d+1 と d で) キューに入る
+        reserve_queue(2 * H * W + 1);
+
+        // 番兵のマスは -1 (入れない)
+        std::vector<signed char> enter((H + 2) * W2, -1);
+        for (int i = 0; i < H; i++) {
+            for (int j = 0; j < W; j++) enter[index(i, j)] = (signed char)cost(i, j);
+        }
+
+        std::fill(_dist.begin(), _dist.end(), INF);
+        head = tail = 0;
+        for (auto [i, j] : sources) {
+            int p = index(i, j);
+            if (_dist[p] == 0) continue;
+            _dist[p] = 0;
+            push_back(p);
+        }
+
+        while (head != tail) {
+            int p = pop_front();
+            for (int k = 0; k < 4; k++) {
+                int q = p + offset[k];
+                int c = enter[q];
+                if (c < 0) continue;
+                int nd = _dist[p] + c;
+                if (_dist[q] <= nd) continue;
+                _dist[q] = nd;
+                if (c == 0) push_front(q);
+                else push_back(q);
+            }
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: dist
+     - 機能  : 直前の探索で求めたマス (i, j) までの距離を返す
+     - 引数  : int i, j : マス (0 <= i < H, 0 <= j < W)
+     - 戻り値: 距離 (到達できなければ INF)
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    int dist(int i, int j) const {
+        if (i < 0 || H <= i || j < 0 || W <= j) {
+            printf("[GridBFS] Error: argument of dist function is inappropriate.\n");
+            printf("(i, j) : (%d,%d)\n", i, j);
+            return INF;
+        }
+        return _dist[index(i, j)];
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: index
+     - 機能  : マス (i, j) の番兵付き1次元配列での添字を返す
+     - 備考  : 番兵の分だけずらしているので、-1 <= i <= H, -1 <= j <= W も指定できる
+    ----------------------------------------------------------*/
+    int index(int i, int j) const { return (i + 1) * W2 + (j + 1); }
+
+    private:
+    int H, W;
+    int W2;                              // 番兵を含めた横幅 (W + 2)
+    std::vector<unsigned char> blocked;  // 通れないマスなら 1 (番兵を含む)
+    std::vector<int> _dist;              // 距離 (番兵を含む1次元配列)
+    int offset[4];                       // 4近傍への添字の差
+    std::vector<int> que;                // リングバッファ
+    int cap = 0;                         // que の容量
+    int head = 0, tail = 0;
+
+    // キューの容量を n 以上にする (足りているときは何もしない)
+    void reserve_queue(int n) {
+        if (cap >= n) return;
+        que.assign(n, 0);
+        cap = n;
+    }
+
+    // 始点が全てグリッドの中にあるか調べ、外にあればエラーを表示する
+    bool valid_sources(const std::vector<std::pair<int,int>>& sources, const char* func) const {
+        for (auto [i, j] : sources) {
+            if (i < 0 || H <= i || j < 0 || W <= j) {
+                printf("[GridBFS] Error: argument of %s function is inappropriate.\n", func);
+                printf("(i, j) : (%d,%d)\n", i, j);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void push_back(int p) {
+        que[tail] = p;
+        if (++tail == cap) tail = 0;
+    }
+    void push_front(int p) {
+        if (head-- == 0) head = cap - 1;
+        que[head] = p;
+    }
+    int pop_front() {
+        int p = que[head];
+        if (++head == cap) head = 0;
+        return p;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,278 @@
+/*----------------------------------------------------------
+ - クラス名  : HLD (Heavy-Light Decomposition)
+ - 機能      : 木を重い辺でつながったパスに分解し、パスと部分木の問い合わせを
+               列の区間の問い合わせに帰着する
+ - 備考      : 頂点を「重い子を先に訪れる DFS 順」に並べ替えるため、
+               ・各 heavy path は連続した区間になる
+               ・部分木 v は区間 [in[v], in[v] + size[v]) になる
+               u-v パスは O(log(n)) 個の区間に分かれる
+               構築は BFS 順と明示的なスタックで行い、再帰しない
+               SegmentTree.cpp と組み合わせてパス・部分木の prod と1点更新を行う
+ - 参考      : https://codeforces.com/blog/entry/53170
+ - 使用例    : HLD hld(N);
+               hld.add_edge(a, b);
+               hld.build(0);
+               SegmentTree<long long, op, e> seg(N);
+               hld.set(seg, v, x);                    // 頂点 v の値を x にする
+               long long s = hld.prod_path(seg, u, v); // u-v パス上の頂点の値の総積
+----------------------------------------------------------*/
+class HLD {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: HLD
+     - 機能  : コンストラクタ
+     - 引数  : int n : 頂点の数 (n >= 1)
+    ----------------------------------------------------------*/
+    HLD(int n) : _n(n), parent(n, -1), depth(n, 0), heavy(n, -1), head(n), in(n), sz(n, 1), order(n) {}
+
+    /*----------------------------------------------------------
+     - 関数名: add_edge
+     - 機能  : 無向辺 (u, v) を追加する
+     - 引数  : int u, v : 端点 (0 <= u,v < n)
+    ----------------------------------------------------------*/
+    void add_edge(int u, int v) {
+        if (u < 0 || _n <= u || v < 0 || _n <= v) {
+            printf("[HLD] Error: argument of add_edge function is inappropriate.\n");
+            printf("(u, v) : (%d,%d)\n", u, v);
+            return;
+        }
+        edges.emplace_back(u, v);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: build
+     - 機能  : root を根として分解する
+     - 引数  : int root : 根 (0 <= root < n)
+     - 備考  : 辺の本数は n - 1 で、木になっていること
+               別の根で何度呼んでもよい
+     - 計算量: O(n)
+    ----------------------------------------------------------*/
+    void build(int root = 0) {
+        if (root < 0 || _n <= root) {
+            printf("[HLD] Error: argument of build function is inappropriate.\n");
+            printf("root: %d\n", root);
+            return;
+        }
+        // 前回の build の結果を消す (sz と heavy は下で加算・比較しながら求めるため)
+        std::fill(sz.begin(), sz.end(), 1);
+        std::fill(heavy.begin(), heavy.end(), -1);
+
+        // CSR 形式の隣接リスト
+        std::vector<int> start(_n + 1, 0), adj(2 * edges.size());
+        for (auto [u, v] : edges) {
+            start[u + 1]++;
+            start[v + 1]++;
+        }
+        for (int i = 0; i < _n; i++) start[i + 1] += start[i];
+        std::vector<int> pos(start.begin(), start.end() - 1);
+        for (auto [u, v] : edges) {
+            adj[pos[u]++] = v;
+            adj[pos[v]++] = u;
+        }
+
+        // BFS 順に親と深さを求め、逆順に部分木の大きさと重い子を求める
+        std::vector<int> bfs{root};
+        bfs.reserve(_n);
+        parent[root] = -1;
+        depth[root] = 0;
+        for (int k = 0; k < (int)bfs.size(); k++) {
+            int v = bfs[k];
+            for (int i = start[v]; i < start[v + 1]; i++) {
+                int to = adj[i];
+                if (to == parent[v]) continue;
+                parent[to] = v;
+                depth[to] = depth[v] + 1;
+                bfs.push_back(to);
+            }
+        }
+        for (int k = (int)bfs.size() - 1; k > 0; k--) {
+            int v = bfs[k], p = parent[v];
+            sz[p] += sz[v];
+            if (heavy[p] == -1 || sz[heavy[p]] < sz[v]) heavy[p] = v;
+        }
+
+        // 軽い子を先に積み、重い子を最後に積むことで重い子が次に取り出される
+        std::vector<int> stack{root};
+        head[root] = root;
+        int t = 0;
+        while (!stack.empty()) {
+            int v = stack.back();
+            stack.pop_back();
+            in[v] = t;
+            order[t++] = v;
+            for (int i = start[v]; i < start[v + 1]; i++) {
+                int to = adj[i];
+                if (to == parent[v] || to == heavy[v]) continue;
+                head[to] = to;
+                stack.push_back(to);
+            }
+            if (heavy[v] != -1) {
+                head[heavy[v]] = head[v];
+                stack.push_back(heavy[v]);
+            }
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: index
+     - 機能  : 頂点 v の列上の位置を返す
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    int index(int v) const { return in[v]; }
+
+    /*----------------------------------------------------------
+     - 関数名: lca
+     - 機能  : 頂点 u, v の最小共通祖先を返す
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    int lca(int u, int v) const {
+        while (head[u] != head[v]) {
+            if (depth[head[u]] < depth[head[v]]) std::swap(u, v);
+            u = parent[head[u]];
+        }
+        return depth[u] < depth[v] ? u : v;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: for_each_path
+     - 機能  : u-v パスを列の半開区間に分解し、各区間 [l, r) について f(l, r) を呼ぶ
+     - 引数  : int u, v : 端点
+               bool edge : true なら LCA を含めない (辺に値を持たせる場合。
+                           辺の値は子の頂点に置く)
+               F f : void(int l, int r)
+     - 備考  : 区間を呼ぶ順序はパスの順序と一致しない
+     - 計算量: O(log(n)) 個の区間
+    ----------------------------------------------------------*/
+    template <class F>
+    void for_each_path(int u, int v, bool edge, F f) const {
+        while (head[u] != head[v]) {
+            if (depth[head[u]] < depth[head[v]]) std::swap(u, v);
+            f(in[head[u]], in[u] + 1);
+            u = parent[head[u]];
+        }
+        if (depth[u] > depth[v]) std::swap(u, v);
+        if (in[u] + (edge ? 1 : 0) < in[v] + 1) f(in[u] + (edge ? 1 : 0), in[v] + 1);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: set
+     - 機能  : 頂点 v の値を x に更新する
+     - 引数  : SegmentTree<S, op, e>& seg : 列を管理するセグ木 (大きさ n)
+               int v : 頂点
+               const S& x : 値
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    template <class S, S (*op)(S, S), S (*e)()>
+    void set(SegmentTree<S, op, e>& seg, int v, const S& x) const {
+        seg.set(in[v], x);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: prod_path
+     - 機能  : u-v パス上の頂点 (edge = true なら辺) の値の総積を返す
+     - 引数  : SegmentTree<S, op, e>& seg : 列を管理するセグ木
+               int u, v : 端点
+               bool edge : true なら LCA の値を含めない
+     - 条件  : op は可換であること (区間を順不同に掛け合わせるため)
+     - 計算量: O(log(n)^2)
+    ----------------------------------------------------------*/
+    template <class S, S (*op)(S, S), S (*e)()>
+    S prod_path(SegmentTree<S, op, e>& seg, int u, int v, bool edge = false) const {
+        S result = e();
+        for_each_path(u, v, edge, [&](int l, int r) { result = op(result, seg.prod(l, r)); });
+        return result;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: prod_subtree
+     - 機能  : 頂点 v の部分木に含まれる頂点の値の総積を返す
+     - 引数  : SegmentTree<S, op, e>& seg : 列を管理するセグ木
+               int v : 部分木の根
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    template <class S, S (*op)(S, S), S (*e)()>
+    S prod_subtree(SegmentTree<S, op, e>& seg, int v) const {
+        return seg.prod(in[v], in[v] + sz[v]);
+    }
+
+    int size() const { return _n; }
+    int get_parent(int v) const { return parent[v]; }
+    int get_depth(int v) const { return depth[v]; }
+    int subtree_size(int v) const { return sz[v]; }
+    int vertex_at(int i) const { return order[i]; } // 列の i 番目の頂点
+
+    private:
+    int _n;
+    std::vector<int> parent, depth;
+    std::vector<int> heavy;  // 部分木が最大の子 (葉なら -1)
+    std::vector<int> head;   // 属する heavy path の最も根に近い頂点
+    std::vector<int> in;     // 列上の位置
+    std::vector<int> sz;     // 部分木の大きさ
+    std::vector<int> order;  // order[in[v]] = v
+    std::vector<std::pair<int,int>> edges;
+};
+
+/*----------------------------------------------------------
+ - クラス名  : LCA
+ - 機能      : 最小共通祖先を O(1) で求める
+ - 備考      : HLD の頂点の並び (DFS の行きがけ順) を Euler Tour として使う
+               in[u] < in[v] のとき、lca(u, v) は列の区間 (in[u], in[v]] で深さが最小の
+               頂点の親になる。これをスパーステーブルで O(1) で求める
+               (長さ 2n の Euler Tour の代わりに長さ n の列で済む)
+               構築時に HLD の列上の位置と深さを複製するので、構築後は HLD を
+               破棄・再構築してもよい (再構築した結果は反映されない)
+ - 計算量    : 構築 O(n log(n))、問い合わせ O(1)
+ - 使用例    : LCA lca(hld);
+               int w = lca(u, v);
+----------------------------------------------------------*/
+class LCA {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: LCA
+     - 機能  : コンストラクタ
+     - 引数  : const HLD& hld : build 済みの HLD
+    ----------------------------------------------------------*/
+    LCA(const HLD& hld) : in(hld.size()), depth(hld.size()) {
+        int n = hld.size();
+        for (int v = 0; v < n; v++) {
+            in[v] = hld.index(v);
+            depth[v] = hld.get_depth(v);
+        }
+        int levels = 1;
+        while ((1 << levels) <= n) levels++;
+        table.assign(levels, std::vector<int>(n));
+
+        // table[0][i] = 列の i 番目の頂点の親 (比較は親の深さで行う)
+        for (int i = 0; i < n; i++) {
+            int v = hld.vertex_at(i);
+            table[0][i] = (hld.get_parent(v) == -1 ? v : hld.get_parent(v));
+        }
+        for (int k = 1; k < levels; k++) {
+            for (int i = 0; i + (1 << k) <= n; i++) {
+                table[k][i] = shallower(table[k - 1][i], table[k - 1][i + (1 << (k - 1))]);
+            }
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: operator()
+     - 機能  : 頂点 u, v の最小共通祖先を返す
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    int operator()(int u, int v) const {
+        if (u == v) return u;
+        int l = in[u], r = in[v];
+        if (l > r) std::swap(l, r);
+        l++; // 区間 [l, r] の頂点の親のうち最も浅いもの
+        int k = 31 - __builtin_clz(r - l + 1);
+        return shallower(table[k][l], table[k][r - (1 << k) + 1]);
+    }
+
+    private:
+    std::vector<int> in, depth;          // HLD の列上の位置と深さの複製
+    std::vector<std::vector<int>> table; // table[k][i] : 区間 [i, i + 2^k) の親のうち最も浅いもの
+
+    int shallower(int a, int b) const { return depth[a] < depth[b] ? a : b; }
+};
\ No newline at end of file
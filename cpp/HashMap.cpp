@@ -0,0 +1,331 @@
+/*----------------------------------------------------------
+ - クラス名  : SplitMixHash
+ - 機能      : 実行ごとに乱数で seed を変える splitmix64 ハッシュ
+ - 備考      : 固定のハッシュ関数 (std::hash<long long> は恒等写像) を狙って
+               衝突させる入力 (anti-hash) への対策
+               整数、pair、tuple (要素も再帰的に) をキーにできる
+ - 参考      : https://codeforces.com/blog/entry/62393
+----------------------------------------------------------*/
+struct SplitMixHash {
+    static uint64_t splitmix64(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    static uint64_t seed() {
+        static const uint64_t s = splitmix64(
+            (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count() ^ (uint64_t)(uintptr_t)&s);
+        return s;
+    }
+
+    // seed は実行ごとに1回だけ決め、ハッシュ関数ごとに持つ (呼び出しのたびに static の初期化を確かめない)
+    uint64_t _seed = seed();
+
+    template <class T>
+    std::enable_if_t<std::is_integral<T>::value, uint64_t> operator()(T x) const {
+        return splitmix64((uint64_t)x + _seed);
+    }
+
+    template <class T, class U>
+    uint64_t operator()(const std::pair<T, U>& p) const {
+        return splitmix64((*this)(p.first) ^ ((*this)(p.second) << 1));
+    }
+
+    template <class... Ts>
+    uint64_t operator()(const std::tuple<Ts...>& t) const {
+        uint64_t h = 0;
+        std::apply([&](const Ts&... xs) { ((h = splitmix64(h ^ (*this)(xs))), ...); }, t);
+        return h;
+    }
+};
+
+/*----------------------------------------------------------
+ - クラス名  : HashMap
+ - 機能      : オープンアドレス法 (線形探索) のハッシュマップ (unordered_map の代わり)
+ - パラメータ : class K : キーの型 (整数、pair、tuple)
+               class V : 値の型
+               class Hash : ハッシュ関数 (既定値は SplitMixHash)
+ - 備考      : 要素を1つの配列に直接並べるため、unordered_map のようなノードの確保と
+               ポインタの参照がない。容量は 2 の累乗で、要素数が容量の半分を超えたら
+               2 倍に広げる
+               削除は後ろの要素を詰め直す (backward shift) ため墓標を残さず、
+               削除を繰り返しても探索が遅くならない
+               unordered_map と異なり、挿入・削除で要素が移動するので、
+               参照やイテレータは次の挿入・削除まで (clear と rehash も) しか有効でない
+               要素は unordered_map と同じく pair<const K, V> で、キーは書き換えられない
+               (スロットの領域に直接構築し、移動は構築し直しと破棄で行う)
+ - 使用例    : HashMap<long long, int> mp;
+               mp[x]++;
+               if (mp.count(y)) ...
+               auto it = mp.find(z);
+               if (it != mp.end()) cout << it->second << endl;
+               mp.erase(x);
+               for (auto& [k, v] : mp) ...
+----------------------------------------------------------*/
+template <class K, class V, class Hash = SplitMixHash>
+class HashMap {
+    public:
+    using value_type = std::pair<const K, V>;
+
+    private:
+    // used が true のときだけ buf に value_type が構築されている
+    struct Slot {
+        alignas(value_type) unsigned char buf[sizeof(value_type)];
+        bool used = false;
+
+        value_type& kv() { return *std::launder(reinterpret_cast<value_type*>(buf)); }
+        const value_type& kv() const { return *std::launder(reinterpret_cast<const value_type*>(buf)); }
+    };
+
+    public:
+
+    template <bool Const>
+    class Iterator {
+        using SlotPtr = std::conditional_t<Const, const Slot*, Slot*>;
+        using Ref = std::conditional_t<Const, const value_type&, value_type&>;
+
+        public:
+        Iterator(SlotPtr p, SlotPtr end) : _p(p), _end(end) { skip(); }
+        Ref operator*() const { return _p->kv(); }
+        auto operator->() const { return &_p->kv(); }
+        Iterator& operator++() {
+            ++_p;
+            skip();
+            return *this;
+        }
+        bool operator==(const Iterator& other) const { return _p == other._p; }
+        bool operator!=(const Iterator& other) const { return _p != other._p; }
+
+        private:
+        SlotPtr _p, _end;
+        void skip() {
+            while (_p != _end && !_p->used) ++_p;
+        }
+    };
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /*----------------------------------------------------------
+     - 関数名: HashMap
+     - 機能  : コンストラクタ
+     - 引数  : int n : 予め確保する要素数 (reserve と同じ)
+    ----------------------------------------------------------*/
+    explicit HashMap(int n = 0) { reserve(n); }
+
+    HashMap(const HashMap& other) : slots(other.slots.size()), mask(other.mask), _size(other._size), hash(other.hash) {
+        for (int i = 0; i < (int)slots.size(); i++) {
+            if (!other.slots[i].used) continue;
+            new (slots[i].buf) value_type(other.slots[i].kv());
+            slots[i].used = true;
+        }
+    }
+
+    HashMap(HashMap&& other) : HashMap() { swap(other); }
+
+    // コピーしてから交換する (ムーブなら O(1))
+    HashMap& operator=(HashMap other) {
+        swap(other);
+        return *this;
+    }
+
+    ~HashMap() { clear(); }
+
+    void swap(HashMap& other) {
+        std::swap(slots, other.slots);
+        std::swap(mask, other.mask);
+        std::swap(_size, other._size);
+        std::swap(hash, other.hash);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: operator[]
+     - 機能  : キー key の値への参照を返す (なければ V() を挿入する)
+     - 計算量: 平均 O(1)
+    ----------------------------------------------------------*/
+    V& operator[](const K& key) {
+        int i = find_slot(key);
+        if (slots[i].used) return slots[i].kv().second;
+        if (2 * (_size + 1) > (int)slots.size()) {
+            rehash(2 * (int)slots.size());
+            i = find_slot(key);
+        }
+        new (slots[i].buf) value_type(key, V());
+        slots[i].used = true;
+        _size++;
+        return slots[i].kv().second;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: insert
+     - 機能  : キー key がなければ値 val で挿入する
+     - 戻り値: bool : 挿入したら true (既にあれば何もせず false)
+     - 計算量: 平均 O(1)
+    ----------------------------------------------------------*/
+    bool insert(const K& key, const V& val) {
+        int i = find_slot(key);
+        if (slots[i].used) return false;
+        (*this)[key] = val;
+        return true;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: find
+     - 機能  : キー key の要素を指すイテレータを返す (なければ end())
+     - 計算量: 平均 O(1)
+    ----------------------------------------------------------*/
+    iterator find(const K& key) {
+        int i = find_slot(key);
+        if (!slots[i].used) return end();
+        return iterator(slots.data() + i, slots.data() + slots.size());
+    }
+    const_iterator find(const K& key) const {
+        int i = find_slot(key);
+        if (!slots[i].used) return end();
+        return const_iterator(slots.data() + i, slots.data() + slots.size());
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: count
+     - 機能  : キー key があれば 1、なければ 0 を返す
+     - 計算量: 平均 O(1)
+    ----------------------------------------------------------*/
+    int count(const K& key) const { return slots[find_slot(key)].used ? 1 : 0; }
+    bool contains(const K& key) const { return slots[find_slot(key)].used; }
+
+    /*----------------------------------------------------------
+     - 関数名: erase
+     - 機能  : キー key を削除する
+     - 戻り値: int : 削除した要素数 (0 か 1)
+     - 備考  : 空きの後ろで本来の位置 (ハッシュ値の位置) より先にある要素を
+               空きに詰めていき、探索の連続性を保つ
+     - 計算量: 平均 O(1)
+    ----------------------------------------------------------*/
+    int erase(const K& key) {
+        int i = find_slot(key);
+        if (!slots[i].used) return 0;
+        slots[i].kv().~value_type();
+        int j = i;
+        while (true) {
+            j = (j + 1) & mask;
+            if (!slots[j].used) break;
+            int home = (int)(hash(slots[j].kv().first) & mask);
+            // home が (i, j] の (循環した) 区間にあれば j は動かせない
+            bool stay = (i <= j ? (i < home && home <= j) : (i < home || home <= j));
+            if (stay) continue;
+            move_slot(j, i);
+            i = j;
+        }
+        slots[i].used = false;
+        _size--;
+        return 1;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: reserve
+     - 機能  : n 個の要素を広げ直さずに入れられるように容量を確保する
+    ----------------------------------------------------------*/
+    void reserve(int n) {
+        int cap = 4;
+        while (cap < 2 * n) cap *= 2;
+        if (cap > (int)slots.size()) rehash(cap);
+    }
+
+    void clear() {
+        for (Slot& s : slots) {
+            if (!s.used) continue;
+            s.kv().~value_type();
+            s.used = false;
+        }
+        _size = 0;
+    }
+
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    iterator begin() { return iterator(slots.data(), slots.data() + slots.size()); }
+    iterator end() { return iterator(slots.data() + slots.size(), slots.data() + slots.size()); }
+    const_iterator begin() const { return const_iterator(slots.data(), slots.data() + slots.size()); }
+    const_iterator end() const { return const_iterator(slots.data() + slots.size(), slots.data() + slots.size()); }
+
+    private:
+    std::vector<Slot> slots;
+    int mask = 0;
+    int _size = 0;
+    Hash hash;
+
+    // key がある位置、なければ挿入すべき空きの位置
+    int find_slot(const K& key) const {
+        int i = (int)(hash(key) & mask);
+        while (slots[i].used && !(slots[i].kv().first == key)) i = (i + 1) & mask;
+        return i;
+    }
+
+    // 要素を slots[from] から空きの slots[to] へ移す (slots[from] の要素は破棄する)
+    static void move_slot(Slot& from, Slot& to) {
+        new (to.buf) value_type(std::move(from.kv()));
+        to.used = true;
+        from.kv().~value_type();
+    }
+    void move_slot(int from, int to) { move_slot(slots[from], slots[to]); }
+
+    void rehash(int cap) {
+        std::vector<Slot> old(cap);
+        std::swap(old, slots);
+        mask = cap - 1;
+        for (Slot& s : old) {
+            if (s.used) move_slot(s, slots[find_slot(s.kv().first)]);
+        }
+    }
+};
+
+/*----------------------------------------------------------
+ - クラス名  : HashSet
+ - 機能      : オープンアドレス法のハッシュ集合 (unordered_set の代わり)
+ - 備考      : HashMap<K, char> の値を使わずにキーだけを見せる
+ - 使用例    : HashSet<pair<int,int>> st;
+               st.insert({x, y});
+               if (st.count({x, y})) ...
+               for (auto& p : st) ...
+----------------------------------------------------------*/
+template <class K, class Hash = SplitMixHash>
+class HashSet {
+    using Map = HashMap<K, char, Hash>;
+
+    public:
+    class const_iterator {
+        public:
+        const_iterator(typename Map::const_iterator it) : _it(it) {}
+        const K& operator*() const { return (*_it).first; }
+        const K* operator->() const { return &(*_it).first; }
+        const_iterator& operator++() {
+            ++_it;
+            return *this;
+        }
+        bool operator==(const const_iterator& other) const { return _it == other._it; }
+        bool operator!=(const const_iterator& other) const { return _it != other._it; }
+
+        private:
+        typename Map::const_iterator _it;
+    };
+    using iterator = const_iterator;
+
+    explicit HashSet(int n = 0) : map(n) {}
+
+    // 挿入したら true (既にあれば false)
+    bool insert(const K& key) { return map.insert(key, 0); }
+    int erase(const K& key) { return map.erase(key); }
+    int count(const K& key) const { return map.count(key); }
+    bool contains(const K& key) const { return map.contains(key); }
+    const_iterator find(const K& key) const { return const_iterator(map.find(key)); }
+    void reserve(int n) { map.reserve(n); }
+    void clear() { map.clear(); }
+    int size() const { return map.size(); }
+    bool empty() const { return map.empty(); }
+    const_iterator begin() const { return const_iterator(map.begin()); }
+    const_iterator end() const { return const_iterator(map.end()); }
+
+    private:
+    Map map;
+};
\ No newline at end of file
@@ -0,0 +1,303 @@
+/*----------------------------------------------------------
+ - クラス名  : LiChaoTree
+ - 機能      : 直線 (線分) の追加と、点 x での最小値の計算を O(log(n)) で行う
+               (dp[i] = min_j (a_j * x_i + b_j) の遷移を O(n log(n)) にする)
+ - 備考      : 問い合わせる x 座標を先に全て渡し、その添字の上のセグメント木の
+               各ノードに「区間の中央で最小となる直線」を1本ずつ持たせる
+               直線の比較は __int128 で行うので、a * x が long long を超えてもよい
+               (最小値自体は T に収まること)
+               最大値を求めるときは IsMin = false にする (内部で符号を反転する)
+ - パラメータ : class T : 座標と係数の型 (整数型)
+               bool IsMin : true なら最小値、false なら最大値
+ - 計算量    : 直線の追加 O(log(n))、線分の追加 O(log^2(n))、最小値 O(log(n))
+ - 使用例    : // dp[i] = min_{j<i} (dp[j] + (X[i] - X[j])^2)
+               //       = X[i]^2 + min_j (-2X[j] * X[i] + dp[j] + X[j]^2)
+               LiChaoTree<long long> lc(X);
+               dp[0] = 0;
+               lc.add_line(-2 * X[0], dp[0] + X[0] * X[0]);
+               rep2(i, 1, N) {
+                   dp[i] = X[i] * X[i] + lc.get(X[i]);
+                   lc.add_line(-2 * X[i], dp[i] + X[i] * X[i]);
+               }
+----------------------------------------------------------*/
+template <class T, bool IsMin = true>
+class LiChaoTree {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: LiChaoTree
+     - 機能  : コンストラクタ
+     - 引数  : const vector<T>& xs : 問い合わせる x 座標 (順不同、重複可)
+    ----------------------------------------------------------*/
+    explicit LiChaoTree(const std::vector<T>& xs) : coords(xs) {
+        std::sort(coords.begin(), coords.end());
+        coords.erase(std::unique(coords.begin(), coords.end()), coords.end());
+        if (coords.empty()) coords.push_back(T(0));
+        _n = (int)coords.size();
+        _size = 1;
+        while (_size < _n) _size *= 2;
+        // 2 の累乗に揃えるため、末尾の座標を繰り返して埋める
+        coords.resize(_size, coords.back());
+        lines.assign(2 * _size, Line{0, std::numeric_limits<T>::max()});
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: add_line
+     - 機能  : 直線 y = a * x + b を追加する
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    void add_line(T a, T b) { insert(make(a, b), 1, 0, _size); }
+
+    /*----------------------------------------------------------
+     - 関数名: add_segment
+     - 機能  : 線分 y = a * x + b (xl <= x < xr) を追加する
+     - 引数  : T a, b   : 傾きと切片
+               T xl, xr : x の範囲 (半開区間)
+     - 備考  : 範囲を O(log(n)) 個のノードに分け、それぞれに直線として追加する
+     - 計算量: O(log^2(n))
+    ----------------------------------------------------------*/
+    void add_segment(T a, T b, T xl, T xr) {
+        int l = index(xl) + _size, r = index(xr) + _size;
+        const Line f = make(a, b);
+        for (int len = 1; l < r; l >>= 1, r >>= 1, len <<= 1) {
+            if (l & 1) {
+                insert(f, l, l * len - _size, l * len - _size + len);
+                l++;
+            }
+            if (r & 1) {
+                r--;
+                insert(f, r, r * len - _size, r * len - _size + len);
+            }
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: get
+     - 機能  : 点 x での最小値 (IsMin = false なら最大値) を返す
+     - 引数  : T x : コンストラクタで渡した座標のいずれか
+     - 戻り値: T : 最小値 (直線がなければ numeric_limits<T>::max()、最大値なら -max())
+     - 備考  : 葉から根までのノードの直線だけを見る
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    T get(T x) const {
+        const int i = index(x);
+        if (i >= _n || coords[i] != x) {
+            printf("[LiChaoTree] Error: argument of get function is inappropriate.\n");
+            printf("x: %lld\n", (long long)x);
+            return sign(std::numeric_limits<T>::max());
+        }
+        __int128 res = std::numeric_limits<T>::max();
+        for (int k = i + _size; k >= 1; k >>= 1) res = std::min(res, eval(lines[k], x));
+        return sign((T)res);
+    }
+
+    private:
+    struct Line {
+        T a, b;
+    };
+
+    int _n, _size;
+    std::vector<T> coords;
+    std::vector<Line> lines; // lines[k] : ノード k の直線 (ヒープの順、葉は _size + i)
+
+    static T sign(T v) { return IsMin ? v : -v; }
+    static Line make(T a, T b) { return Line{sign(a), sign(b)}; }
+    static __int128 eval(const Line& f, T x) { return (__int128)f.a * x + f.b; }
+
+    // x 以上の最初の座標の添字
+    int index(T x) const { return (int)(std::lower_bound(coords.begin(), coords.begin() + _n, x) - coords.begin()); }
+
+    // ノード k (添字の範囲 [l, r)) に直線 f を追加する
+    // 中央で良い方をノードに残し、負けた方を交点のある側の子へ下ろす
+    void insert(Line f, int k, int l, int r) {
+        while (true) {
+            const int m = (l + r) / 2;
+            Line& g = lines[k];
+            const bool lef = eval(f, coords[l]) < eval(g, coords[l]);
+            const bool mid = eval(f, coords[m]) < eval(g, coords[m]);
+            if (mid) std::swap(f, g);
+            if (r - l == 1) return;
+            if (lef != mid) {
+                k = 2 * k;
+                r = m;
+            } else {
+                k = 2 * k + 1;
+                l = m;
+            }
+        }
+    }
+};
+
+/*----------------------------------------------------------
+ - クラス名  : DynamicLiChaoTree
+ - 機能      : x 座標を先に決めずに使える Li Chao Tree (座標の範囲は [lo, hi])
+ - 備考      : 直線を置いたノードだけを作る。ノードは vector に並べ、子は添字で指す
+               (ポインタと new を使わない。clear は確保した領域を残して空にするので、
+                Arena の reset と同じく複数のテストケースで使い回せる)
+               直線の追加で作るノードは高々1個なので、ノード数は追加した直線の数以下
+               (線分の追加は O(log(hi - lo)) 個)
+               座標は ±1e18 まで扱える (中点は l + (r - l) / 2 で求める)
+               最大値を求めるときは IsMin = false にする
+ - パラメータ : class T : 座標と係数の型 (整数型)
+               bool IsMin : true なら最小値、false なら最大値
+ - 計算量    : 直線の追加と最小値 O(log(hi - lo))、線分の追加 O(log^2(hi - lo))
+ - 使用例    : DynamicLiChaoTree<long long> lc(-1e18, 1e18);
+               lc.add_line(a, b);
+               long long v = lc.get(x);
+----------------------------------------------------------*/
+template <class T, bool IsMin = true>
+class DynamicLiChaoTree {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: DynamicLiChaoTree
+     - 機能  : コンストラクタ
+     - 引数  : T lo, hi     : 座標の範囲 (lo <= hi、hi - lo が T に収まること)
+               int capacity : 予め確保するノード数
+    ----------------------------------------------------------*/
+    DynamicLiChaoTree(T lo, T hi, int capacity = 0) : _lo(lo), _hi(hi) {
+        if (hi < lo) {
+            printf("[DynamicLiChaoTree] Error: argument of constructor is inappropriate.\n");
+            printf("lo: %lld, hi: %lld\n", (long long)lo, (long long)hi);
+            _hi = lo;
+        }
+        nodes.reserve(capacity);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: add_line
+     - 機能  : 直線 y = a * x + b を追加する
+     - 計算量: O(log(hi - lo))
+    ----------------------------------------------------------*/
+    void add_line(T a, T b) {
+        if (nodes.empty()) new_node();
+        insert(make(a, b), 0, _lo, _hi);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: add_segment
+     - 機能  : 線分 y = a * x + b (xl <= x < xr) を追加する
+     - 計算量: O(log^2(hi - lo))
+    ----------------------------------------------------------*/
+    void add_segment(T a, T b, T xl, T xr) {
+        xl = std::max(xl, _lo);
+        if (xr - 1 > _hi) xr = _hi + 1;
+        if (xr <= xl) return;
+        if (nodes.empty()) new_node();
+        add_segment(make(a, b), xl, xr - 1, 0, _lo, _hi);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: get
+     - 機能  : 点 x での最小値 (IsMin = false なら最大値) を返す
+     - 引数  : T x : 座標 (lo <= x <= hi)
+     - 戻り値: T : 最小値 (直線がなければ numeric_limits<T>::max()、最大値なら -max())
+     - 計算量: O(log(hi - lo))
+    ----------------------------------------------------------*/
+    T get(T x) const {
+        if (x < _lo || _hi < x) {
+            printf("[DynamicLiChaoTree] Error: argument of get function is inappropriate.\n");
+            printf("x: %lld\n", (long long)x);
+            return sign(std::numeric_limits<T>::max());
+        }
+        __int128 res = std::numeric_limits<T>::max();
+        T l = _lo, r = _hi;
+        int k = nodes.empty() ? -1 : 0;
+        while (k >= 0) {
+            const Node& nd = nodes[k];
+            if (nd.has) res = std::min(res, eval(nd.f, x));
+            const T m = l + (r - l) / 2;
+            if (x <= m) {
+                k = nd.left;
+                r = m;
+            } else {
+                k = nd.right;
+                l = m + 1;
+            }
+        }
+        return sign((T)res);
+    }
+
+    // 全ての直線を削除する (ノードの領域は残す)
+    void clear() { nodes.clear(); }
+
+    // 作ったノードの数
+    int node_count() const { return (int)nodes.size(); }
+
+    private:
+    struct Line {
+        T a, b;
+    };
+    struct Node {
+        Line f;
+        bool has; // 直線を置いたか (線分の追加で途中のノードだけ作ることがある)
+        int left, right;
+    };
+
+    T _lo, _hi;
+    std::vector<Node> nodes; // nodes[0] が根
+
+    static T sign(T v) { return IsMin ? v : -v; }
+    static Line make(T a, T b) { return Line{sign(a), sign(b)}; }
+    static __int128 eval(const Line& f, T x) { return (__int128)f.a * x + f.b; }
+
+    int new_node() {
+        nodes.push_back(Node{Line{0, 0}, false, -1, -1});
+        return (int)nodes.size() - 1;
+    }
+
+    // ノード k (座標の範囲 [l, r]) に直線 f を追加する
+    // (push_back で参照が無効になるので、ノードは毎回添字で引く)
+    void insert(Line f, int k, T l, T r) {
+        while (true) {
+            if (!nodes[k].has) {
+                nodes[k].f = f;
+                nodes[k].has = true;
+                return;
+            }
+            const T m = l + (r - l) / 2;
+            const bool lef = eval(f, l) < eval(nodes[k].f, l);
+            const bool mid = eval(f, m) < eval(nodes[k].f, m);
+            if (mid) std::swap(f, nodes[k].f);
+            if (l == r) return;
+            if (lef != mid) {
+                if (nodes[k].left < 0) {
+                    int c = new_node();
+                    nodes[k].left = c;
+                }
+                k = nodes[k].left;
+                r = m;
+            } else {
+                if (nodes[k].right < 0) {
+                    int c = new_node();
+                    nodes[k].right = c;
+                }
+                k = nodes[k].right;
+                l = m + 1;
+            }
+        }
+    }
+
+    // [xl, xr] を覆うノードに直線 f を追加する
+    void add_segment(const Line& f, T xl, T xr, int k, T l, T r) {
+        if (xl <= l && r <= xr) {
+            insert(f, k, l, r);
+            return;
+        }
+        const T m = l + (r - l) / 2;
+        if (xl <= m) {
+            if (nodes[k].left < 0) {
+                int c = new_node();
+                nodes[k].left = c;
+            }
+            add_segment(f, xl, xr, nodes[k].left, l, m);
+        }
+        if (m < xr) {
+            if (nodes[k].right < 0) {
+                int c = new_node();
+                nodes[k].right = c;
+            }
+            add_segment(f, xl, xr, nodes[k].right, m + 1, r);
+        }
+    }
+};
\ No newline at end of file
@@ -0,0 +1,333 @@
+/*----------------------------------------------------------
+ - クラス名  : MaxFlow
+ - 機能      : 有向グラフの最大流を求める
+ - パラメータ : class Cap : 容量の型 (int, long long など)
+ - 備考      : 辺と逆辺は頂点ごとに連続した1本の配列 (CSR 形式) に並べ、
+               各辺は逆辺の位置 rev を持つ
+               add_edge では辺を溜めるだけで、flow を呼んだときに配列を作る
+               (その後に辺を追加しても、それまでの流量を保ったまま作り直す)
+               ・flow              : Dinic 法 (current arc 付き)
+               ・flow_push_relabel : 最高ラベル優先の Push-Relabel 法 (密なグラフ向け)
+ - 参考      : ac-library maxflow.hpp
+ - 使用例    : MaxFlow<int> g(N);
+               g.add_edge(0, 1, 3);
+               int f = g.flow(0, N - 1);
+----------------------------------------------------------*/
+template <class Cap>
+class MaxFlow {
+    public:
+    struct Edge {
+        int from, to;
+        Cap cap, flow;
+    };
+
+    /*----------------------------------------------------------
+     - 関数名: MaxFlow
+     - 機能  : コンストラクタ
+     - 引数  : int n : 頂点の数
+    ----------------------------------------------------------*/
+    MaxFlow(int n) : _n(n) {}
+
+    /*----------------------------------------------------------
+     - 関数名: add_edge
+     - 機能  : from -> to に容量 cap の辺を追加する
+     - 引数  : int from, to : 端点 (0 <= from,to < n)
+               Cap cap : 容量 (cap >= 0)
+     - 戻り値: int : 辺の番号 (追加した順に 0, 1, ...)
+    ----------------------------------------------------------*/
+    int add_edge(int from, int to, Cap cap) {
+        if (from < 0 || from >= _n || to < 0 || to >= _n || cap < 0) {
+            printf("[MaxFlow] Error: argument of add_edge function is inappropriate.\n");
+            printf("(from, to) : (%d,%d)\n", from, to);
+            return -1;
+        }
+        efrom.push_back(from);
+        eto.push_back(to);
+        ecap.push_back(cap);
+        return (int)efrom.size() - 1;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: flow
+     - 機能  : s から t へ最大で limit だけ流し、流した量を返す (Dinic 法)
+     - 引数  : int s, t : 始点と終点 (s != t)
+               Cap limit : 流す量の上限
+     - 戻り値: Cap : 流した量
+     - 備考  : BFS で距離ラベルを付け、距離が1ずつ増える辺だけを使って
+               増加路を探す。各頂点は次に調べる辺の位置 (current arc) を覚え、
+               行き止まりの頂点は距離ラベルを消して再訪しない
+               DFS は非再帰で行う
+     - 計算量: O(N^2 M) (実際にはずっと速い)
+    ----------------------------------------------------------*/
+    Cap flow(int s, int t, Cap limit = std::numeric_limits<Cap>::max()) {
+        if (s < 0 || s >= _n || t < 0 || t >= _n || s == t) {
+            printf("[MaxFlow] Error: argument of flow function is inappropriate.\n");
+            printf("(s, t) : (%d,%d)\n", s, t);
+            return 0;
+        }
+        build();
+
+        std::vector<int> level(_n), iter(_n), que(_n), path;
+        Cap total = 0;
+        while (total < limit) {
+            // 残余グラフ上の s からの距離
+            std::fill(level.begin(), level.end(), -1);
+            level[s] = 0;
+            int qh = 0, qt = 0;
+            que[qt++] = s;
+            while (qh < qt && level[t] < 0) {
+                int v = que[qh++];
+                for (int i = start[v]; i < start[v + 1]; i++) {
+                    const Arc& a = arcs[i];
+                    if (a.cap == 0 || level[a.to] >= 0) continue;
+                    level[a.to] = level[v] + 1;
+                    que[qt++] = a.to;
+                }
+            }
+            if (level[t] < 0) break;
+
+            // 増加路が見つからなくなるまで流す (ブロッキングフロー)
+            std::copy(start.begin(), start.end() - 1, iter.begin());
+            while (total < limit) {
+                path.clear();
+                int v = s;
+                while (v != t) {
+                    int& i = iter[v];
+                    while (i < start[v + 1]) {
+                        const Arc& a = arcs[i];
+                        if (a.cap > 0 && level[a.to] == level[v] + 1) break;
+                        i++;
+                    }
+                    if (i < start[v + 1]) {
+                        path.push_back(i);
+                        v = arcs[i].to;
+                        continue;
+                    }
+
+                    // 行き止まり: v を使えなくして1つ戻る
+                    if (v == s) break;
+                    level[v] = -1;
+                    int back = path.back();
+                    path.pop_back();
+                    v = arcs[arcs[back].rev].to;
+                    iter[v]++;
+                }
+                if (v != t) break;
+
+                Cap f = limit - total;
+                for (int i : path) f = std::min(f, arcs[i].cap);
+                for (int i : path) {
+                    arcs[i].cap -= f;
+                    arcs[arcs[i].rev].cap += f;
+                }
+                total += f;
+            }
+        }
+        return total;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: flow_push_relabel
+     - 機能  : s から t への最大流を流し、流した量を返す (Push-Relabel 法)
+     - 引数  : int s, t : 始点と終点 (s != t)
+     - 戻り値: Cap : 流した量
+     - 備考  : 余剰のある頂点のうち高さが最大のものから押し出す (最高ラベル優先)
+               relabel が N 回行われるごとに、残余グラフ上の t (届かなければ s) からの
+               距離で高さを付け直す (global relabeling)
+               t に届かない余剰は s に押し戻すので、終了時には正しいフローになる
+     - 計算量: O(N^2 sqrt(M))
+    ----------------------------------------------------------*/
+    Cap flow_push_relabel(int s, int t) {
+        if (s < 0 || s >= _n || t < 0 || t >= _n || s == t) {
+            printf("[MaxFlow] Error: argument of flow_push_relabel function is inappropriate.\n");
+            printf("(s, t) : (%d,%d)\n", s, t);
+            return 0;
+        }
+        build();
+
+        const int n = _n, H = 2 * n; // 高さは H 未満
+        std::vector<Cap> excess(n, 0);
+        std::vector<int> height(n), iter(n), que(n);
+        std::vector<int> bucket_head(H, -1), bucket_next(n); // 高さごとの余剰のある頂点のリスト
+        int highest = -1;
+
+        auto activate = [&](int v) {
+            if (v == s || v == t || height[v] >= H) return;
+            bucket_next[v] = bucket_head[height[v]];
+            bucket_head[height[v]] = v;
+            highest = std::max(highest, height[v]);
+        };
+
+        // 残余グラフで root に到達できる頂点へ、base + 距離 の高さを付ける
+        auto bfs = [&](int root, int base) {
+            int qh = 0, qt = 0;
+            height[root] = base;
+            que[qt++] = root;
+            while (qh < qt) {
+                int v = que[qh++];
+                for (int i = start[v]; i < start[v + 1]; i++) {
+                    int u = arcs[i].to;
+                    if (height[u] < H || arcs[arcs[i].rev].cap == 0) continue;
+                    height[u] = height[v] + 1;
+                    que[qt++] = u;
+                }
+            }
+        };
+        auto global_relabel = [&]() {
+            std::fill(height.begin(), height.end(), H);
+            bfs(t, 0);
+            if (height[s] == H) bfs(s, n);
+            else height[s] = n;
+            std::fill(bucket_head.begin(), bucket_head.end(), -1);
+            highest = -1;
+            for (int v = 0; v < n; v++) {
+                iter[v] = start[v];
+                if (excess[v] > 0) activate(v);
+            }
+        };
+
+        auto push = [&](int v, int i, Cap d) {
+            Arc& a = arcs[i];
+            if (excess[a.to] == 0) {
+                excess[a.to] = d; // 先に余剰を正にしてから activate する
+                activate(a.to);
+            } else {
+                excess[a.to] += d;
+            }
+            excess[v] -= d;
+            a.cap -= d;
+            arcs[a.rev].cap += d;
+        };
+
+        // s から出る辺を全て飽和させる
+        for (int i = start[s]; i < start[s + 1]; i++) {
+            if (arcs[i].cap > 0) push(s, i, arcs[i].cap);
+        }
+        global_relabel();
+
+        int relabels = 0;
+        while (highest >= 0) {
+            int v = bucket_head[highest];
+            if (v == -1) {
+                highest--;
+                continue;
+            }
+            bucket_head[highest] = bucket_next[v];
+
+            // v の余剰がなくなるまで押し出す (discharge)
+            while (excess[v] > 0) {
+                if (iter[v] == start[v + 1]) {
+                    // relabel: 残余辺の行き先の高さの最小値 + 1 にする
+                    int h = H;
+                    for (int i = start[v]; i < start[v + 1]; i++) {
+                        if (arcs[i].cap > 0) h = std::min(h, height[arcs[i].to] + 1);
+                    }
+                    height[v] = h;
+                    iter[v] = start[v];
+                    relabels++;
+                    if (h >= H) break;
+                    continue;
+                }
+                const Arc& a = arcs[iter[v]];
+                if (a.cap > 0 && height[v] == height[a.to] + 1) {
+                    push(v, iter[v], std::min(excess[v], a.cap));
+                } else {
+                    iter[v]++;
+                }
+            }
+
+            if (relabels >= n) {
+                relabels = 0;
+                global_relabel();
+            }
+        }
+        return excess[t];
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: get_edge
+     - 機能  : i 番目の辺の状態を返す
+     - 引数  : int i : add_edge の戻り値
+     - 戻り値: Edge : (from, to, 容量, 流量)
+    ----------------------------------------------------------*/
+    Edge get_edge(int i) {
+        if (i < 0 || (int)efrom.size() <= i) {
+            printf("[MaxFlow] Error: argument of get_edge function is inappropriate.\n");
+            printf("i: %d\n", i);
+            return Edge{-1, -1, 0, 0};
+        }
+        build();
+        return Edge{efrom[i], eto[i], ecap[i], arcs[arcs[epos[i]].rev].cap};
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: min_cut
+     - 機能  : 最小カットの s 側の頂点集合を返す
+     - 引数  : int s : flow を呼んだときの始点
+     - 戻り値: result[v] = 残余グラフで s から v に到達できるなら true
+     - 備考  : flow の後に呼ぶこと
+     - 計算量: O(N + M)
+    ----------------------------------------------------------*/
+    std::vector<bool> min_cut(int s) {
+        build();
+        std::vector<bool> visited(_n, false);
+        std::vector<int> que{s};
+        visited[s] = true;
+        for (int qh = 0; qh < (int)que.size(); qh++) {
+            int v = que[qh];
+            for (int i = start[v]; i < start[v + 1]; i++) {
+                if (arcs[i].cap == 0 || visited[arcs[i].to]) continue;
+                visited[arcs[i].to] = true;
+                que.push_back(arcs[i].to);
+            }
+        }
+        return visited;
+    }
+
+    private:
+    struct Arc {
+        int to;  // 行き先
+        int rev; // 逆辺の arcs 内での位置
+        Cap cap; // 残余容量
+    };
+
+    int _n;
+    std::vector<int> efrom, eto;  // 追加された辺の端点
+    std::vector<Cap> ecap;        // 追加された辺の容量
+    std::vector<int> epos;        // 辺 i の順方向の arcs 内での位置
+    std::vector<int> start;       // v から出る辺は arcs[start[v]] ... arcs[start[v+1]-1]
+    std::vector<Arc> arcs;
+    int built = 0;                // arcs に反映済みの辺の本数
+
+    /*----------------------------------------------------------
+     - 関数名: build
+     - 機能  : 追加された辺から CSR 形式の配列を作る
+     - 備考  : 既に作ってある場合は、それまでの流量を引き継いで作り直す
+     - 計算量: O(N + M)
+    ----------------------------------------------------------*/
+    void build() {
+        const int m = (int)efrom.size();
+        if (built == m && !start.empty()) return;
+
+        std::vector<Cap> flow(m, 0);
+        for (int i = 0; i < built; i++) flow[i] = arcs[arcs[epos[i]].rev].cap;
+
+        start.assign(_n + 1, 0);
+        for (int i = 0; i < m; i++) {
+            start[efrom[i] + 1]++;
+            start[eto[i] + 1]++;
+        }
+        for (int v = 0; v < _n; v++) start[v + 1] += start[v];
+
+        std::vector<int> pos(start.begin(), start.end() - 1);
+        arcs.resize(2 * m);
+        epos.resize(m);
+        for (int i = 0; i < m; i++) {
+            int p = pos[efrom[i]]++, q = pos[eto[i]]++;
+            arcs[p] = Arc{eto[i], q, ecap[i] - flow[i]};
+            arcs[q] = Arc{efrom[i], p, flow[i]};
+            epos[i] = p;
+        }
+        built = m;
+    }
+};
\ No newline at end of file
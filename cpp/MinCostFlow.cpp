@@ -0,0 +1,182 @@
+/*----------------------------------------------------------
+ - クラス名  : MinCostFlow
+ - 機能      : 有向グラフの最小費用流を求める
+ - パラメータ : class Cap : 容量の型
+               class Cost : 費用の型
+ - 条件      : 辺の費用は 0 以上であること
+ - 備考      : MaxFlow と同じく、辺と逆辺を CSR 形式の1本の配列に並べる
+               ポテンシャル (双対変数) で費用を非負に保ち、Dijkstra 法で
+               最短路を求めて流す (Primal-Dual 法)
+ - 計算量    : 流量を F として O(F (N + M) log(N))
+ - 参考      : ac-library mincostflow.hpp
+ - 使用例    : MinCostFlow<int, long long> g(N);
+               g.add_edge(0, 1, 2, 10); // 容量 2、費用 10
+               auto [f, c] = g.flow(0, N - 1, K);
+----------------------------------------------------------*/
+template <class Cap, class Cost>
+class MinCostFlow {
+    public:
+    struct Edge {
+        int from, to;
+        Cap cap, flow;
+        Cost cost;
+    };
+
+    /*----------------------------------------------------------
+     - 関数名: MinCostFlow
+     - 機能  : コンストラクタ
+     - 引数  : int n : 頂点の数
+    ----------------------------------------------------------*/
+    MinCostFlow(int n) : _n(n) {}
+
+    /*----------------------------------------------------------
+     - 関数名: add_edge
+     - 機能  : from -> to に容量 cap、単位流量あたりの費用 cost の辺を追加する
+     - 引数  : int from, to : 端点 (0 <= from,to < n)
+               Cap cap : 容量 (cap >= 0)
+               Cost cost : 費用 (cost >= 0)
+     - 戻り値: int : 辺の番号 (追加した順に 0, 1, ...)
+    ----------------------------------------------------------*/
+    int add_edge(int from, int to, Cap cap, Cost cost) {
+        if (from < 0 || from >= _n || to < 0 || to >= _n || cap < 0 || cost < 0) {
+            printf("[MinCostFlow] Error: argument of add_edge function is inappropriate.\n");
+            printf("(from, to) : (%d,%d)\n", from, to);
+            return -1;
+        }
+        edges.push_back(Edge{from, to, cap, 0, cost});
+        return (int)edges.size() - 1;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: flow
+     - 機能  : s から t へ最大で limit だけ、費用が最小になるように流す
+     - 引数  : int s, t : 始点と終点 (s != t)
+               Cap limit : 流す量の上限
+     - 戻り値: (流した量, 費用の合計)
+     - 備考  : 1回だけ呼ぶこと (ポテンシャルを引き継がないため、2回目以降は
+               逆辺の負の費用で正しい結果にならない。2回目はエラーを表示して {0, 0} を返す)
+    ----------------------------------------------------------*/
+    std::pair<Cap, Cost> flow(int s, int t, Cap limit = std::numeric_limits<Cap>::max()) {
+        if (s < 0 || s >= _n || t < 0 || t >= _n || s == t) {
+            printf("[MinCostFlow] Error: argument of flow function is inappropriate.\n");
+            printf("(s, t) : (%d,%d)\n", s, t);
+            return {0, 0};
+        }
+        if (flowed) {
+            printf("[MinCostFlow] Error: flow function can be called only once.\n");
+            return {0, 0};
+        }
+        flowed = true;
+        build();
+
+        const Cost inf = std::numeric_limits<Cost>::max();
+        std::vector<Cost> dual(_n, 0), dist(_n);
+        std::vector<int> prev_arc(_n);
+        std::vector<bool> visited(_n);
+        std::priority_queue<std::pair<Cost, int>, std::vector<std::pair<Cost, int>>, std::greater<>> que;
+
+        Cap total = 0;
+        Cost total_cost = 0;
+        while (total < limit) {
+            // 被約費用 cost - dual[to] + dual[v] (>= 0) で Dijkstra
+            std::fill(dist.begin(), dist.end(), inf);
+            std::fill(visited.begin(), visited.end(), false);
+            dist[s] = 0;
+            que.emplace(0, s);
+            while (!que.empty()) {
+                int v = que.top().second;
+                que.pop();
+                if (visited[v]) continue;
+                visited[v] = true;
+                if (v == t) break;
+                for (int i = start[v]; i < start[v + 1]; i++) {
+                    const Arc& a = arcs[i];
+                    if (a.cap == 0 || visited[a.to]) continue;
+                    Cost nd = dist[v] + a.cost - dual[a.to] + dual[v];
+                    if (nd < dist[a.to]) {
+                        dist[a.to] = nd;
+                        prev_arc[a.to] = i;
+                        que.emplace(nd, a.to);
+                    }
+                }
+            }
+            while (!que.empty()) que.pop();
+            if (!visited[t]) break;
+
+            // 確定した頂点のポテンシャルを更新する (被約費用は非負のまま保たれる)
+            for (int v = 0; v < _n; v++) {
+                if (visited[v]) dual[v] -= dist[t] - dist[v];
+            }
+
+            // 最短路に沿って流せるだけ流す
+            Cap f = limit - total;
+            for (int v = t; v != s; v = arcs[arcs[prev_arc[v]].rev].to) f = std::min(f, arcs[prev_arc[v]].cap);
+            for (int v = t; v != s; v = arcs[arcs[prev_arc[v]].rev].to) {
+                Arc& a = arcs[prev_arc[v]];
+                a.cap -= f;
+                arcs[a.rev].cap += f;
+                total_cost += (Cost)f * a.cost;
+            }
+            total += f;
+        }
+
+        for (int i = 0; i < (int)edges.size(); i++) edges[i].flow = arcs[arcs[epos[i]].rev].cap;
+        return {total, total_cost};
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: get_edge
+     - 機能  : i 番目の辺の状態を返す (flow の後に呼ぶこと)
+     - 引数  : int i : add_edge の戻り値
+     - 戻り値: Edge : (from, to, 容量, 流量, コスト)
+    ----------------------------------------------------------*/
+    Edge get_edge(int i) const {
+        if (i < 0 || (int)edges.size() <= i) {
+            printf("[MinCostFlow] Error: argument of get_edge function is inappropriate.\n");
+            printf("i: %d\n", i);
+            return Edge{-1, -1, 0, 0, 0};
+        }
+        return edges[i];
+    }
+
+    private:
+    struct Arc {
+        int to;    // 行き先
+        int rev;   // 逆辺の arcs 内での位置
+        Cap cap;   // 残余容量
+        Cost cost; // 費用 (逆辺は -cost)
+    };
+
+    int _n;
+    std::vector<Edge> edges;  // 追加された辺
+    std::vector<int> epos;    // 辺 i の順方向の arcs 内での位置
+    std::vector<int> start;   // v から出る辺は arcs[start[v]] ... arcs[start[v+1]-1]
+    std::vector<Arc> arcs;
+    bool flowed = false;      // flow を呼んだか
+
+    /*----------------------------------------------------------
+     - 関数名: build
+     - 機能  : 追加された辺から CSR 形式の配列を作る
+     - 計算量: O(N + M)
+    ----------------------------------------------------------*/
+    void build() {
+        const int m = (int)edges.size();
+        start.assign(_n + 1, 0);
+        for (const Edge& e : edges) {
+            start[e.from + 1]++;
+            start[e.to + 1]++;
+        }
+        for (int v = 0; v < _n; v++) start[v + 1] += start[v];
+
+        std::vector<int> pos(start.begin(), start.end() - 1);
+        arcs.resize(2 * m);
+        epos.resize(m);
+        for (int i = 0; i < m; i++) {
+            const Edge& e = edges[i];
+            int p = pos[e.from]++, q = pos[e.to]++;
+            arcs[p] = Arc{e.to, q, e.cap - e.flow, e.cost};
+            arcs[q] = Arc{e.from, p, e.flow, -e.cost};
+            epos[i] = p;
+        }
+    }
+};
\ No newline at end of file
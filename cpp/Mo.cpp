@@ -0,0 +1,344 @@
+/*----------------------------------------------------------
+ - 関数名: hilbert_order
+ - 機能  : 2^lg x 2^lg の格子上の点 (x, y) のヒルベルト曲線上の順番を返す
+ - 引数  : int x, y : 座標 (0 <= x, y < 2^lg)
+           int lg   : 格子の大きさの対数 (lg <= 31)
+ - 戻り値: uint64_t : 順番 (0 <= 戻り値 < 4^lg)
+ - 備考  : ヒルベルト曲線は隣り合う番号の点が格子上でも隣り合うため、
+           この順に点をたどると移動距離の合計が小さくなる
+ - 計算量: O(lg)
+----------------------------------------------------------*/
+uint64_t hilbert_order(int x, int y, int lg) {
+    const int n = 1 << lg;
+    uint64_t d = 0;
+    for (int s = n >> 1; s > 0; s >>= 1) {
+        int rx = (x & s) > 0;
+        int ry = (y & s) > 0;
+        d += (uint64_t)s * s * ((3 * rx) ^ ry);
+        // 小さい正方形の中の向きに合わせて座標を回転する
+        if (ry == 0) {
+            if (rx == 1) {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+/*----------------------------------------------------------
+ - クラス名  : Mo
+ - 機能      : 区間の伸縮が O(1) でできる問題の区間クエリをオフラインで処理する
+ - 備考      : クエリ [l, r) を点 (l, r) とみなし、ヒルベルト曲線の順に並べ替えて
+               区間の両端を動かしながら答える
+               ヒルベルト曲線の順は、左端のブロックごとに右端を昇順・降順と交互に並べる順序と
+               一様な乱数のクエリで同程度の移動量で、クエリが偏っていても崩れにくく、
+               ブロックの大きさを決める必要もない
+               並べ替えは RadixSort.cpp の基数ソートで O(q) で行う
+               RadixSort.cpp を先に貼ること
+ - 計算量    : 両端の移動の合計 O(n sqrt(q))
+ - 使用例    : // 区間の異なる値の個数
+               Mo mo(N);
+               rep(i, Q) mo.add(L[i], R[i]);
+               vector<int> cnt(M), ans(Q);
+               int kind = 0;
+               auto add = [&](int i) { if (cnt[A[i]]++ == 0) kind++; };
+               auto erase = [&](int i) { if (--cnt[A[i]] == 0) kind--; };
+               mo.run(add, erase, [&](int q) { ans[q] = kind; });
+----------------------------------------------------------*/
+class Mo {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: Mo
+     - 機能  : コンストラクタ
+     - 引数  : int n : 列の長さ
+    ----------------------------------------------------------*/
+    explicit Mo(int n) : _n(n) {}
+
+    /*----------------------------------------------------------
+     - 関数名: add
+     - 機能  : 半開区間 [l, r) のクエリを追加する (番号は追加した順に 0, 1, 2, ...)
+     - 引数  : int l, r : 区間の端点 (0 <= l <= r <= n)
+    ----------------------------------------------------------*/
+    void add(int l, int r) {
+        if (l < 0 || r < l || _n < r) {
+            printf("[Mo] Error: argument of add function is inappropriate.\n");
+            printf("l: %d, r: %d\n", l, r);
+            return;
+        }
+        ls.push_back(l);
+        rs.push_back(r);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: run
+     - 機能  : 全てのクエリを処理する
+     - 引数  : add_left(i)     : 区間の左に要素 i を加える
+               add_right(i)    : 区間の右に要素 i を加える
+               erase_left(i)   : 区間の左の要素 i を取り除く
+               erase_right(i)  : 区間の右の要素 i を取り除く
+               out(q)          : 今の区間がクエリ q の区間なので答えを記録する
+     - 備考  : 区間を広げてから縮めるので、区間が空でないのに要素を取り除くことはない
+               関数オブジェクトはテンプレートで受け取るので、ラムダ式が展開される
+     - 計算量: O(n sqrt(q)) 回の呼び出し
+    ----------------------------------------------------------*/
+    template <class AL, class AR, class EL, class ER, class Out>
+    void run(const AL& add_left, const AR& add_right, const EL& erase_left, const ER& erase_right, const Out& out) {
+        int l = 0, r = 0;
+        for (int q : order()) {
+            PROF_COUNT("Mo/moves", std::abs(ls[q] - l) + std::abs(rs[q] - r));
+            while (l > ls[q]) add_left(--l);
+            while (r < rs[q]) add_right(r++);
+            while (l < ls[q]) erase_left(l++);
+            while (r > rs[q]) erase_right(--r);
+            out(q);
+        }
+    }
+
+    // 左右を区別しない場合
+    template <class A, class E, class Out>
+    void run(const A& add, const E& erase, const Out& out) {
+        run(add, add, erase, erase, out);
+    }
+
+    private:
+    int _n;
+    std::vector<int> ls, rs;
+
+    // クエリをヒルベルト曲線の順に並べた番号の列
+    std::vector<int> order() const {
+        const int q = (int)ls.size();
+        int lg = 0;
+        while ((1 << lg) <= _n) lg++;
+        std::vector<uint64_t> keys(q);
+        std::vector<int> ord(q);
+        for (int i = 0; i < q; i++) {
+            keys[i] = hilbert_order(ls[i], rs[i], lg);
+            ord[i] = i;
+        }
+        radix_sort_by_key(keys, ord);
+        return ord;
+    }
+};
+
+/*----------------------------------------------------------
+ - クラス名  : MoWithUpdates
+ - 機能      : 1点更新を含む区間クエリをオフラインで処理する (時間軸つきの Mo)
+ - 備考      : クエリを (l, r, t) (t はそれまでの更新の回数) とみなし、
+               l と r をブロックに分けて (l のブロック, r のブロック, t) の順に並べる
+               r のブロックが奇数番目なら t を降順にして、時間の移動を往復させる
+               ブロックの大きさは 2 * (n^2 * 更新数 / クエリ数)^(1/3) (n = q なら n^(2/3) 程度)
+               (更新が少ないときは通常の Mo と同じ n / sqrt(q) を下限にする)
+               更新は「列の値と更新の値を入れ替える」ように書くと、同じ関数で
+               適用と取り消しができる (使用例を参照)
+               RadixSort.cpp を先に貼ること
+ - 計算量    : 両端と時間の移動の合計 O(n^(5/3)) (n = q = 更新数のとき)
+ - 使用例    : // 1点更新と区間の異なる値の個数
+               MoWithUpdates mo(N);
+               vector<int> P, X; // 更新: A[P[t]] = X[t]
+               rep(i, Q) {
+                   if (type == 1) { mo.add_update(); P.push_back(p); X.push_back(x); }
+                   else mo.add_query(l, r);
+               }
+               auto add = [&](int i) { if (cnt[A[i]]++ == 0) kind++; };
+               auto erase = [&](int i) { if (--cnt[A[i]] == 0) kind--; };
+               auto update = [&](int t, int l, int r) {
+                   int p = P[t];
+                   if (l <= p && p < r) { erase(p); swap(A[p], X[t]); add(p); }
+                   else swap(A[p], X[t]);
+               };
+               mo.run(add, erase, update, [&](int q) { ans[q] = kind; });
+----------------------------------------------------------*/
+class MoWithUpdates {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: MoWithUpdates
+     - 機能  : コンストラクタ
+     - 引数  : int n : 列の長さ
+    ----------------------------------------------------------*/
+    explicit MoWithUpdates(int n) : _n(n) {}
+
+    /*----------------------------------------------------------
+     - 関数名: add_update
+     - 機能  : 更新を1つ追加する (以降のクエリはこの更新の後の列に対するもの)
+     - 戻り値: int : 更新の番号 (追加した順に 0, 1, 2, ...)
+    ----------------------------------------------------------*/
+    int add_update() { return _updates++; }
+
+    /*----------------------------------------------------------
+     - 関数名: add_query
+     - 機能  : 半開区間 [l, r) のクエリを追加する (番号は追加した順に 0, 1, 2, ...)
+     - 引数  : int l, r : 区間の端点 (0 <= l <= r <= n)
+    ----------------------------------------------------------*/
+    void add_query(int l, int r) {
+        if (l < 0 || r < l || _n < r) {
+            printf("[MoWithUpdates] Error: argument of add_query function is inappropriate.\n");
+            printf("l: %d, r: %d\n", l, r);
+            return;
+        }
+        ls.push_back(l);
+        rs.push_back(r);
+        ts.push_back(_updates);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: run
+     - 機能  : 全てのクエリを処理する
+     - 引数  : add(i)          : 区間に要素 i を加える
+               erase(i)        : 区間から要素 i を取り除く
+               update(t, l, r) : 更新 t を適用する、または取り消す (今の区間は [l, r))
+               out(q)          : 今の区間と時刻がクエリ q のものなので答えを記録する
+     - 備考  : 更新 t は適用と取り消しが交互に呼ばれる
+    ----------------------------------------------------------*/
+    template <class A, class E, class U, class Out>
+    void run(const A& add, const E& erase, const U& update, const Out& out) {
+        const int q = (int)ls.size();
+        if (q == 0) return;
+        // 時間の移動 (n/B)^2 * 更新数 と両端の移動 q * B の釣り合うところ
+        // (更新1回は要素の出し入れ2回分になるので、実測で速かった 2 倍にしている)
+        const double b = std::max(2 * std::cbrt((double)_n * _n * _updates / q), _n / std::sqrt((double)q));
+        const int block = std::max(1, std::min(std::max(_n, 1), (int)b));
+        const uint64_t nb = _n / block + 1;
+
+        std::vector<uint64_t> keys(q);
+        std::vector<int> ord(q);
+        for (int i = 0; i < q; i++) {
+            uint64_t lb = ls[i] / block, rb = rs[i] / block;
+            uint64_t t = (rb & 1) ? (uint64_t)(_updates - ts[i]) : (uint64_t)ts[i];
+            keys[i] = (lb * nb + rb) * (uint64_t)(_updates + 1) + t;
+            ord[i] = i;
+        }
+        radix_sort_by_key(keys, ord);
+
+        int l = 0, r = 0, t = 0;
+        for (int i : ord) {
+            PROF_COUNT("MoWithUpdates/moves", std::abs(ls[i] - l) + std::abs(rs[i] - r) + std::abs(ts[i] - t));
+            while (l > ls[i]) add(--l);
+            while (r < rs[i]) add(r++);
+            while (l < ls[i]) erase(l++);
+            while (r > rs[i]) erase(--r);
+            while (t < ts[i]) update(t++, l, r);
+            while (t > ts[i]) update(--t, l, r);
+            out(i);
+        }
+    }
+
+    private:
+    int _n;
+    int _updates = 0;
+    std::vector<int> ls, rs, ts;
+};
+
+/*----------------------------------------------------------
+ - クラス名  : RollbackMo
+ - 機能      : 要素を加える操作と巻き戻しだけで区間クエリをオフラインで処理する
+ - 備考      : 最大値のように、要素を加えるのは簡単だが取り除くのが難しい問題に使う
+               クエリを左端のブロックごとに右端の昇順に並べ、ブロックごとに
+               ・右端はブロックの右の境界から右へ加えていくだけ
+               ・左端は snapshot で状態を記録してから境界の左へ加え、答えたら rollback で戻す
+               区間がブロックに収まるクエリは空の状態から直接加えて rollback で戻す
+               ブロックの大きさは n / sqrt(q)
+               RadixSort.cpp を先に貼ること
+ - 計算量    : 要素を加える回数 O(n sqrt(q))
+ - 使用例    : // 区間の (値 x その値の個数) の最大値
+               RollbackMo mo(N);
+               rep(i, Q) mo.add(L[i], R[i]);
+               vector<int> cnt(M);
+               vector<pair<int, int>> hist; // (値, 加える前の個数)
+               long long best = 0, saved_best = 0;
+               size_t saved_size = 0;
+               auto add = [&](int i) {
+                   hist.push_back({C[i], cnt[C[i]]});
+                   chmax(best, (long long)X[i] * ++cnt[C[i]]);
+               };
+               auto reset = [&]() { for (auto [c, k] : hist) cnt[c] = 0; hist.clear(); best = 0; };
+               auto snapshot = [&]() { saved_size = hist.size(); saved_best = best; };
+               auto rollback = [&]() {
+                   while (hist.size() > saved_size) { cnt[hist.back().first] = hist.back().second; hist.pop_back(); }
+                   best = saved_best;
+               };
+               mo.run(add, add, reset, snapshot, rollback, [&](int q) { ans[q] = best; });
+----------------------------------------------------------*/
+class RollbackMo {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: RollbackMo
+     - 機能  : コンストラクタ
+     - 引数  : int n : 列の長さ
+    ----------------------------------------------------------*/
+    explicit RollbackMo(int n) : _n(n) {}
+
+    /*----------------------------------------------------------
+     - 関数名: add
+     - 機能  : 半開区間 [l, r) のクエリを追加する (番号は追加した順に 0, 1, 2, ...)
+     - 引数  : int l, r : 区間の端点 (0 <= l <= r <= n)
+    ----------------------------------------------------------*/
+    void add(int l, int r) {
+        if (l < 0 || r < l || _n < r) {
+            printf("[RollbackMo] Error: argument of add function is inappropriate.\n");
+            printf("l: %d, r: %d\n", l, r);
+            return;
+        }
+        ls.push_back(l);
+        rs.push_back(r);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: run
+     - 機能  : 全てのクエリを処理する
+     - 引数  : add_left(i)  : 区間の左に要素 i を加える
+               add_right(i) : 区間の右に要素 i を加える
+               reset()      : 状態を空の区間に戻す
+               snapshot()   : 今の状態を記録する
+               rollback()   : 状態を最後に snapshot したときに戻す
+               out(q)       : 今の区間がクエリ q の区間なので答えを記録する
+     - 備考  : snapshot と rollback は必ず1回ずつ対になって呼ばれる (入れ子にならない)
+    ----------------------------------------------------------*/
+    template <class AL, class AR, class Reset, class Snap, class Roll, class Out>
+    void run(const AL& add_left, const AR& add_right, const Reset& reset, const Snap& snapshot, const Roll& rollback, const Out& out) {
+        const int q = (int)ls.size();
+        if (q == 0) return;
+        const int block = std::max(1, (int)(_n / std::sqrt((double)q)));
+
+        std::vector<uint64_t> keys(q);
+        std::vector<int> ord(q);
+        for (int i = 0; i < q; i++) {
+            keys[i] = (uint64_t)(ls[i] / block) * (_n + 1) + rs[i];
+            ord[i] = i;
+        }
+        radix_sort_by_key(keys, ord);
+
+        for (int s = 0; s < q;) {
+            const int b = ls[ord[s]] / block;
+            const int border = std::min(_n, (b + 1) * block);
+            reset();
+            int r = border;
+            for (; s < q && ls[ord[s]] / block == b; s++) {
+                const int i = ord[s];
+                if (rs[i] <= border) {
+                    // 区間がブロックに収まる (右端の昇順なので、まだ右端を伸ばす前で状態は空)
+                    PROF_COUNT("RollbackMo/adds", rs[i] - ls[i]);
+                    snapshot();
+                    for (int j = ls[i]; j < rs[i]; j++) add_right(j);
+                    out(i);
+                    rollback();
+                    continue;
+                }
+                PROF_COUNT("RollbackMo/adds", rs[i] - r + border - ls[i]);
+                while (r < rs[i]) add_right(r++);
+                snapshot();
+                for (int j = border - 1; j >= ls[i]; j--) add_left(j);
+                out(i);
+                rollback();
+            }
+        }
+    }
+
+    private:
+    int _n;
+    std::vector<int> ls, rs;
+};
\ No newline at end of file
@@ -0,0 +1,198 @@
+/*----------------------------------------------------------
+ - 関数名: radix_sort_core
+ - 機能  : 整数のキーを LSD 基数ソートする (vals があれば同じ順に並べ替える)
+ - 引数  : vector<T>& keys : キー (整数型、1 〜 8 バイト)
+           vector<V>* vals : キーと一緒に並べ替える値 (nullptr なら使わない)
+ - 備考  : 11 ビットずつ下の桁から安定な計数ソートを行う
+           (64 ビットで 6 回、32 ビットで 3 回。8 ビットずつより走査が少なく、
+            2048 個のバケットは L1 キャッシュに収まる)
+           ・全ての桁のヒストグラムを最初の1回の走査でまとめて数える
+           ・全てのキーで同じ値になる桁 (値の範囲が狭いときの上位の桁など) は飛ばす
+           ・符号付きの型は符号ビットを反転して符号なしとして比べる
+           要素数が少ないときは std::sort (vals があれば stable_sort) の方が速いのでそちらを使う
+ - 計算量: O(sizeof(T) * (n + 2048))
+----------------------------------------------------------*/
+template <class T, class V = char>
+void radix_sort_core(std::vector<T>& keys, std::vector<V>* vals) {
+    static_assert(std::is_integral<T>::value, "radix_sort requires integral keys");
+    using U = std::make_unsigned_t<T>;
+    constexpr int BITS = 8 * sizeof(T);
+    constexpr int RADIX_BITS = 11;
+    constexpr int BUCKETS = 1 << RADIX_BITS;
+    constexpr int DIGITS = (BITS + RADIX_BITS - 1) / RADIX_BITS;
+    const U flip = (std::is_signed<T>::value ? U(U(1) << (BITS - 1)) : U(0));
+    const int n = (int)keys.size();
+
+    if (n < 256) {
+        if (vals == nullptr) {
+            std::sort(keys.begin(), keys.end());
+            return;
+        }
+        std::vector<int> order(n);
+        for (int i = 0; i < n; i++) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](int i, int j) { return keys[i] < keys[j]; });
+        std::vector<T> k2(n);
+        std::vector<V> v2(n);
+        for (int i = 0; i < n; i++) {
+            k2[i] = keys[order[i]];
+            v2[i] = std::move((*vals)[order[i]]);
+        }
+        keys.swap(k2);
+        vals->swap(v2);
+        return;
+    }
+
+    // cnt[d][b] : d 桁目 (下から) が b のキーの個数
+    std::vector<std::array<int, BUCKETS>> cnt(DIGITS);
+    for (auto& c : cnt) c.fill(0);
+    for (int i = 0; i < n; i++) {
+        U x = (U)keys[i] ^ flip;
+        for (int d = 0; d < DIGITS; d++) cnt[d][(x >> (RADIX_BITS * d)) & (BUCKETS - 1)]++;
+    }
+
+    std::vector<T> ktmp(n);
+    std::vector<V> vtmp(vals != nullptr ? n : 0);
+    T* ksrc = keys.data();
+    T* kdst = ktmp.data();
+    V* vsrc = (vals != nullptr ? vals->data() : nullptr);
+    V* vdst = vtmp.data();
+    bool swapped = false;
+    for (int d = 0; d < DIGITS; d++) {
+        const int shift = RADIX_BITS * d;
+        if (cnt[d][(((U)ksrc[0] ^ flip) >> shift) & (BUCKETS - 1)] == n) continue; // 全て同じ桁
+
+        std::array<int, BUCKETS> pos;
+        int sum = 0;
+        for (int b = 0; b < BUCKETS; b++) {
+            pos[b] = sum;
+            sum += cnt[d][b];
+        }
+        if (vsrc == nullptr) {
+            for (int i = 0; i < n; i++) kdst[pos[(((U)ksrc[i] ^ flip) >> shift) & (BUCKETS - 1)]++] = ksrc[i];
+        } else {
+            for (int i = 0; i < n; i++) {
+                int p = pos[(((U)ksrc[i] ^ flip) >> shift) & (BUCKETS - 1)]++;
+                kdst[p] = ksrc[i];
+                vdst[p] = std::move(vsrc[i]);
+            }
+        }
+        std::swap(ksrc, kdst);
+        std::swap(vsrc, vdst);
+        swapped = !swapped;
+    }
+
+    // 奇数回だけ並べ替えたときは結果が作業用の配列にある
+    if (swapped) {
+        keys.swap(ktmp);
+        if (vals != nullptr) vals->swap(vtmp);
+    }
+}
+
+/*----------------------------------------------------------
+ - 関数名: radix_sort
+ - 機能  : 整数の列を昇順にソートする (std::sort の代わり)
+ - 引数  : vector<T>& a : ソートする列 (int, long long, unsigned など)
+ - 計算量: O(sizeof(T) * n)
+ - 使用例: vector<long long> a(N);
+           radix_sort(a);
+----------------------------------------------------------*/
+template <class T>
+void radix_sort(std::vector<T>& a) {
+    radix_sort_core<T, char>(a, nullptr);
+}
+
+/*----------------------------------------------------------
+ - 関数名: radix_sort_by_key
+ - 機能  : keys を昇順にソートし、vals を同じ順に並べ替える
+ - 引数  : vector<K>& keys : キー (整数型)
+           vector<V>& vals : 値 (keys と同じ長さ)
+ - 備考  : 安定なので、キーが等しい要素は元の順に並ぶ
+ - 計算量: O(sizeof(K) * n)
+ - 使用例: vector<int> idx(N);
+           iota(idx.begin(), idx.end(), 0);
+           vector<long long> key = A;
+           radix_sort_by_key(key, idx); // idx は A を昇順に並べたときの添字 (argsort)
+----------------------------------------------------------*/
+template <class K, class V>
+void radix_sort_by_key(std::vector<K>& keys, std::vector<V>& vals) {
+    if (keys.size() != vals.size()) {
+        printf("[radix_sort_by_key] Error: keys and vals must have the same length.\n");
+        printf("keys: %d, vals: %d\n", (int)keys.size(), (int)vals.size());
+        return;
+    }
+    radix_sort_core<K, V>(keys, &vals);
+}
+
+/*----------------------------------------------------------
+ - クラス名  : Compressor
+ - 機能      : 座標圧縮 (値を小さい順に 0, 1, 2, ... の番号に置き換える)
+ - 備考      : sort + unique + lower_bound の代わりに、(値, 添字) を基数ソートし、
+               1回の走査で異なる値の表と入力の全ての要素の番号を作る
+               入力に含まれない値の番号は id (二分探索) で求める
+ - 計算量    : 構築 O(sizeof(T) * n)、id は O(log(n))
+ - 使用例    : Compressor<long long> comp(X);
+               const vector<int>& cx = comp.ids(); // cx[i] は X[i] の番号
+               BIT<int> bit(comp.size());
+               rep(i, N) bit.add(cx[i], 1);
+               long long x0 = comp.value(0);      // 最小の値
+----------------------------------------------------------*/
+template <class T>
+class Compressor {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: Compressor
+     - 機能  : コンストラクタ (xs の値を圧縮する)
+     - 引数  : const vector<T>& xs : 値の列
+    ----------------------------------------------------------*/
+    Compressor(const std::vector<T>& xs) : _ids(xs.size()) {
+        const int n = (int)xs.size();
+        std::vector<T> keys(xs);
+        std::vector<int> idx(n);
+        for (int i = 0; i < n; i++) idx[i] = i;
+        radix_sort_by_key(keys, idx);
+        for (int i = 0; i < n; i++) {
+            if (i == 0 || keys[i] != keys[i - 1]) vals.push_back(keys[i]);
+            _ids[idx[i]] = (int)vals.size() - 1;
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: ids
+     - 機能  : 入力の各要素の番号を返す
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    const std::vector<int>& ids() const { return _ids; }
+
+    /*----------------------------------------------------------
+     - 関数名: id
+     - 機能  : x 以上の最小の値の番号を返す (x が入力にあれば x の番号)
+     - 戻り値: int : 番号 (x より大きい値がなければ size())
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    int id(const T& x) const { return (int)(std::lower_bound(vals.begin(), vals.end(), x) - vals.begin()); }
+
+    /*----------------------------------------------------------
+     - 関数名: value
+     - 機能  : 番号 i の値を返す
+     - 引数  : int i : 番号 (0 <= i < size())
+    ----------------------------------------------------------*/
+    T value(int i) const {
+        if (i < 0 || (int)vals.size() <= i) {
+            printf("[Compressor] Error: argument of value function is inappropriate.\n");
+            printf("i: %d\n", i);
+            return T();
+        }
+        return vals[i];
+    }
+
+    // 異なる値の個数
+    int size() const { return (int)vals.size(); }
+
+    // 異なる値の昇順の列
+    const std::vector<T>& values() const { return vals; }
+
+    private:
+    std::vector<T> vals;
+    std::vector<int> _ids;
+};
\ No newline at end of file
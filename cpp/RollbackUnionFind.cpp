@@ -0,0 +1,291 @@
+/*----------------------------------------------------------
+ - クラス名  : RollbackUnionFind
+ - 機能      : 結合操作を取り消せる UnionFind
+ - 備考      : 経路圧縮を行わず Union by Size のみを適用するため、
+               各操作は O(log(n)) となる
+               変更した配列の値を履歴に積み、巻き戻すときに書き戻す
+----------------------------------------------------------*/
+class RollbackUnionFind {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: RollbackUnionFind
+     - 機能  : コンストラクタ
+     - 引数  : int n : 頂点の数 (n >= 1)
+     - 使用例: RollbackUnionFind uf(100);
+    ----------------------------------------------------------*/
+    RollbackUnionFind(int n) : _n(n), _count(n), parent_or_size(n, -1) {}
+
+    /*----------------------------------------------------------
+     - 関数名: merge
+     - 機能  : 頂点 a、b を結合する
+     - 引数  : int a, b : 結合する2頂点 (0 <= a,b < n)
+     - 戻り値: bool : 新たに結合したなら true (既に同じ連結成分なら false)
+     - 備考  : 結合したときだけ履歴を積む
+     - 計算量: O(log(n))
+     - 使用例: uf.merge(2,3);
+    ----------------------------------------------------------*/
+    bool merge(int a, int b) {
+        if (a < 0 || _n <= a || b < 0 || _n <= b) {
+            printf("[RollbackUnionFind] Error: argument of merge function is inappropriate.\n");
+            printf("a: %d, b: %d\n", a, b);
+            return false;
+        }
+
+        int root_a = root(a);
+        int root_b = root(b);
+        if (root_a == root_b) return false;
+
+        // 頂点数の多い連結成分へ併合する
+        if (-parent_or_size[root_a] < -parent_or_size[root_b]) std::swap(root_a, root_b);
+        history.emplace_back(root_a, parent_or_size[root_a]);
+        history.emplace_back(root_b, parent_or_size[root_b]);
+        parent_or_size[root_a] += parent_or_size[root_b];
+        parent_or_size[root_b] = root_a;
+        _count--;
+        return true;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: same
+     - 機能  : 頂点 a、b が同じ連結成分に属するかを返す
+     - 引数  : int a, b : 調べる2頂点 (0 <= a,b < n)
+     - 戻り値: bool : 同じ連結成分に属するなら true
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    bool same(int a, int b) {
+        if (a < 0 || _n <= a || b < 0 || _n <= b) {
+            printf("[RollbackUnionFind] Error: argument of same function is inappropriate.\n");
+            printf("a: %d, b: %d\n", a, b);
+            return false;
+        }
+        return root(a) == root(b);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: root
+     - 機能  : 頂点 a の根を返す
+     - 引数  : int a : 調べる頂点 (0 <= a < n)
+     - 戻り値: int : a の根
+     - 備考  : 経路圧縮は行わない (木の高さは O(log(n)) に抑えられる)
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    int root(int a) const {
+        while (parent_or_size[a] >= 0) a = parent_or_size[a];
+        return a;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: size
+     - 機能  : 頂点 a の属する連結成分の大きさを返す
+     - 引数  : int a : 調べる頂点 (0 <= a < n)
+     - 戻り値: int : 頂点 a の属する連結成分の大きさ (>= 1)
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    int size(int a) const { return -parent_or_size[root(a)]; }
+
+    /*----------------------------------------------------------
+     - 関数名: count
+     - 機能  : 連結成分の個数を返す
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    int count() const { return _count; }
+
+    /*----------------------------------------------------------
+     - 関数名: snapshot
+     - 機能  : 現在の状態を表す値を返す
+     - 戻り値: int : rollback に渡す値 (履歴の長さ)
+     - 計算量: O(1)
+     - 使用例: int s = uf.snapshot();
+               uf.merge(0, 1);
+               uf.rollback(s); // merge(0, 1) の前に戻る
+    ----------------------------------------------------------*/
+    int snapshot() const { return (int)history.size(); }
+
+    /*----------------------------------------------------------
+     - 関数名: rollback
+     - 機能  : snapshot で得た状態まで巻き戻す
+     - 引数  : int state : snapshot の戻り値 (0 なら初期状態に戻る)
+     - 戻り値: なし
+     - 計算量: O(巻き戻す結合の回数)
+    ----------------------------------------------------------*/
+    void rollback(int state = 0) {
+        if (state < 0 || (int)history.size() < state) {
+            printf("[RollbackUnionFind] Error: argument of rollback function is inappropriate.\n");
+            printf("state: %d, history: %d\n", state, (int)history.size());
+            return;
+        }
+        while ((int)history.size() > state) undo();
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: undo
+     - 機能  : 直前の (成功した) merge を1回取り消す
+     - 戻り値: なし
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    void undo() {
+        if (history.empty()) return;
+        for (int k = 0; k < 2; k++) {
+            parent_or_size[history.back().first] = history.back().second;
+            history.pop_back();
+        }
+        _count++;
+    }
+
+    private:
+    int _n;
+    int _count; // 連結成分の個数
+    std::vector<int> parent_or_size; // 親なら -(連結成分のサイズ)、子なら親の頂点
+    std::vector<std::pair<int,int>> history; // (書き換えた頂点, 書き換える前の値)
+};
+
+/*----------------------------------------------------------
+ - クラス名  : OfflineDynamicConnectivity
+ - 機能      : 辺の追加・削除と連結性の問い合わせをオフラインで処理する
+ - 備考      : 各辺が存在する問い合わせの区間を求め、問い合わせ時刻の
+               セグメント木の O(logQ) 個のノードに辺を載せる
+               セグメント木を DFS しながら RollbackUnionFind で結合・巻き戻しを行う
+ - 計算量    : 操作の数を Q として O(Q log(Q) log(n))
+ - 使用例    : OfflineDynamicConnectivity dc(4);
+               dc.add_edge(0, 1);
+               dc.query(0, 1);      // 0 番目の問い合わせ
+               dc.remove_edge(0, 1);
+               dc.query(0, 1);      // 1 番目の問い合わせ
+               vector<bool> ans = dc.run(); // {true, false}
+----------------------------------------------------------*/
+class OfflineDynamicConnectivity {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: OfflineDynamicConnectivity
+     - 機能  : コンストラクタ
+     - 引数  : int n : 頂点の数 (n >= 1)
+    ----------------------------------------------------------*/
+    OfflineDynamicConnectivity(int n) : _n(n) {}
+
+    /*----------------------------------------------------------
+     - 関数名: add_edge
+     - 機能  : 無向辺 (u, v) を追加する
+     - 引数  : int u, v : 端点 (0 <= u,v < n)
+     - 備考  : 同じ辺を複数本追加してもよい
+    ----------------------------------------------------------*/
+    void add_edge(int u, int v) {
+        if (u < 0 || _n <= u || v < 0 || _n <= v) {
+            printf("[OfflineDynamicConnectivity] Error: argument of add_edge function is inappropriate.\n");
+            printf("(u, v) : (%d,%d)\n", u, v);
+            return;
+        }
+        if (u > v) std::swap(u, v);
+        alive[std::make_pair(u, v)].push_back((int)queries.size());
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: remove_edge
+     - 機能  : 無向辺 (u, v) を1本削除する
+     - 引数  : int u, v : 端点 (追加済みの辺であること)
+    ----------------------------------------------------------*/
+    void remove_edge(int u, int v) {
+        if (u > v) std::swap(u, v);
+        auto it = alive.find(std::make_pair(u, v));
+        if (it == alive.end() || it->second.empty()) {
+            printf("[OfflineDynamicConnectivity] Error: edge to remove does not exist.\n");
+            printf("(u, v) : (%d,%d)\n", u, v);
+            return;
+        }
+        intervals.push_back({it->second.back(), (int)queries.size(), u, v});
+        it->second.pop_back();
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: query
+     - 機能  : 「現時点で u と v は連結か」という問い合わせを登録する
+     - 引数  : int u, v : 調べる2頂点 (0 <= u,v < n)
+     - 戻り値: int : 問い合わせの番号 (run の戻り値の添字)
+    ----------------------------------------------------------*/
+    int query(int u, int v) {
+        queries.emplace_back(u, v);
+        return (int)queries.size() - 1;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: run
+     - 機能  : 登録された全ての問い合わせに答える
+     - 戻り値: 問い合わせ順に並べた答え (連結なら true)
+     - 計算量: O(Q log(Q) log(n))
+    ----------------------------------------------------------*/
+    std::vector<bool> run() {
+        std::vector<bool> result(queries.size());
+        run([&](int t, RollbackUnionFind& uf) {
+            result[t] = uf.same(queries[t].first, queries[t].second);
+        });
+        return result;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: run
+     - 機能  : 各問い合わせの時点の辺集合で結合した UnionFind を f に渡す
+     - 引数  : F f : void(int t, RollbackUnionFind& uf)
+                     t は問い合わせの番号
+     - 備考  : 連結成分の個数など、same 以外の問い合わせに用いる
+               f の中で uf を merge した場合は、f の中で rollback すること
+    ----------------------------------------------------------*/
+    template <class F>
+    void run(F f) {
+        const int Q = (int)queries.size();
+        if (Q == 0) return;
+
+        // 削除されなかった辺は最後まで存在する
+        std::vector<Interval> all = intervals;
+        for (auto& [edge, starts] : alive) {
+            for (int l : starts) all.push_back({l, Q, edge.first, edge.second});
+        }
+
+        int size = 1;
+        while (size < Q) size *= 2;
+
+        // 区間 [l, r) をセグメント木のノードに分解し、CSR 形式で辺を格納する
+        std::vector<int> start(size * 2 + 1, 0);
+        auto for_each_node = [&](int l, int r, auto g) {
+            for (l += size, r += size; l < r; l >>= 1, r >>= 1) {
+                if (l & 1) g(l++);
+                if (r & 1) g(--r);
+            }
+        };
+        for (const Interval& it : all) {
+            for_each_node(it.l, it.r, [&](int k) { start[k + 1]++; });
+        }
+        for (int k = 0; k < size * 2; k++) start[k + 1] += start[k];
+        std::vector<std::pair<int,int>> edges(start[size * 2]);
+        std::vector<int> pos(start.begin(), start.end() - 1);
+        for (const Interval& it : all) {
+            for_each_node(it.l, it.r, [&](int k) { edges[pos[k]++] = std::make_pair(it.u, it.v); });
+        }
+
+        RollbackUnionFind uf(_n);
+        auto dfs = [&](auto self, int k) -> void {
+            if (k >= size && k - size >= Q) return;
+            int state = uf.snapshot();
+            for (int i = start[k]; i < start[k + 1]; i++) uf.merge(edges[i].first, edges[i].second);
+            if (k >= size) {
+                f(k - size, uf);
+            } else {
+                self(self, k * 2);
+                self(self, k * 2 + 1);
+            }
+            uf.rollback(state);
+        };
+        dfs(dfs, 1);
+    }
+
+    private:
+    struct Interval {
+        int l, r; // 辺が存在する問い合わせの区間 [l, r)
+        int u, v;
+    };
+
+    int _n;
+    std::map<std::pair<int,int>, std::vector<int>> alive; // 辺 -> 追加された時刻 (未削除のもの)
+    std::vector<Interval> intervals;
+    std::vector<std::pair<int,int>> queries;
+};
\ No newline at end of file
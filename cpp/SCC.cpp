@@ -1,6 +1,11 @@
 /*----------------------------------------------------------
  - クラス名  : SCC (Strongly connected component)
  - 機能      : 互いに行き来可能な頂点集合（強連結成分）に分解する
+ - 備考      : 辺は add_edge で配列に溜めておき、分解するときに CSR 形式
+               (Compressed Sparse Row) の隣接リストを作る
+               Tarjan のアルゴリズムを非再帰で実行するため、逆辺のグラフは不要で
+               パスグラフのような深いグラフでもスタックを消費しない
+ - 参考      : ac-library internal_scc.hpp
 ----------------------------------------------------------*/
 class SCC {
     public:
@@ -11,8 +16,6 @@ class SCC {
     ----------------------------------------------------------*/
     SCC(int N) {
         _n = N;
-        G.resize(N);
-        rG.resize(N);
     }
 
     /*----------------------------------------------------------
@@ -27,57 +30,180 @@ class SCC {
             printf("(from, to) : (%d,%d)", from, to);
             return;
         }
-        G[from].push_back(to);
-        rG[to].push_back(from);
+        edges.emplace_back(from, to);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: scc_ids
+     - 機能  : 各頂点の属する強連結成分の番号を求める
+     - 引数  : なし
+     - 戻り値: (強連結成分の個数, 各頂点の強連結成分の番号)
+     - 備考  : 番号はトポロジカル順 (辺 u -> v があれば id[u] <= id[v])
+     - 計算量: 辺の本数を M として O(N + M)
+     - 使用例: auto [num, id] = g.scc_ids();
+    ----------------------------------------------------------*/
+    std::pair<int, std::vector<int>> scc_ids() {
+        std::vector<int> start, elist;
+        build_csr(start, elist);
+        return scc_ids(start, elist);
     }
 
     /*----------------------------------------------------------
      - 関数名: scc
      - 機能  : 強連結成分ごとに分解した頂点のリストを返す
      - 引数  : なし
-     - 戻り値: 強連結成分ごとにまとめたグラフのリスト
+     - 戻り値: 強連結成分ごとにまとめたグラフのリスト (トポロジカル順)
      - 計算量: 辺の本数を M として O(N + M)
     ----------------------------------------------------------*/
     std::vector<std::vector<int>> scc() {
-        std::vector<std::vector<int>> scc;
-        std::vector<int> vs;
-        std::vector<bool> visited(_n, false);
+        auto [group_num, ids] = scc_ids();
+        std::vector<int> counts(group_num);
+        for (auto x : ids) counts[x]++;
+        std::vector<std::vector<int>> groups(group_num);
+        for (int i = 0; i < group_num; i++) groups[i].reserve(counts[i]);
+        for (int i = 0; i < _n; i++) groups[ids[i]].push_back(i);
+        return groups;
+    }
 
-        auto dfs = [&](auto self, int v) -> void {
-            visited[v] = true;
-            for (auto e : G[v]) {
-                if (!visited[e]) self(self, e);
-            }
-            vs.push_back(v);
-        };
+    /*----------------------------------------------------------
+     - 構造体名: Condensation
+     - 機能    : condensation の戻り値 (強連結成分を縮約した DAG)
+     - 備考    : 成分 c から出る辺の行き先は elist[start[c]] ... elist[start[c+1]-1]
+                 辺は重複せず、行き先は常に c より大きい
+    ----------------------------------------------------------*/
+    struct Condensation {
+        int num;                // 強連結成分の個数 (DAG の頂点数)
+        std::vector<int> id;    // id[v] = 頂点 v の属する強連結成分の番号 (トポロジカル順)
+        std::vector<int> start; // CSR 形式の各成分の辺の先頭位置 (大きさ num + 1)
+        std::vector<int> elist; // CSR 形式の辺の行き先
+    };
 
-        for (int i = 0; i < _n; i++) {
-            if (!visited[i]) dfs(dfs, i);
-        }
+    /*----------------------------------------------------------
+     - 関数名: condensation
+     - 機能  : 強連結成分を1頂点に縮約した DAG を求める
+     - 引数  : なし
+     - 戻り値: Condensation (頂点番号はトポロジカル順)
+     - 備考  : 成分内の辺は除き、同じ成分間の辺は1本にまとめる
+     - 計算量: 辺の本数を M として O(N + M)
+     - 使用例: auto dag = g.condensation();
+               for (int c = dag.num - 1; c >= 0; c--) {
+                   for (int i = dag.start[c]; i < dag.start[c + 1]; i++) dp[c] += dp[dag.elist[i]];
+               }
+    ----------------------------------------------------------*/
+    Condensation condensation() {
+        std::vector<int> start, elist;
+        build_csr(start, elist);
+        auto [num, ids] = scc_ids(start, elist);
 
-        std::vector<int> rvs;
-        visited.assign(_n, false);
+        // 計数ソートで頂点を成分ごとに並べる
+        std::vector<int> cstart(num + 1, 0), member(_n);
+        for (int v = 0; v < _n; v++) cstart[ids[v] + 1]++;
+        for (int c = 0; c < num; c++) cstart[c + 1] += cstart[c];
+        std::vector<int> pos(cstart.begin(), cstart.end() - 1);
+        for (int v = 0; v < _n; v++) member[pos[ids[v]]++] = v;
 
-        auto rdfs = [&](auto self, int v) -> void {
-            visited[v] = true;
-            for (auto e : rG[v]) {
-                if (!visited[e]) self(self, e);
+        // 成分 c の頂点から出る辺を走査し、成分 c で初めて見た行き先だけを残す
+        Condensation dag;
+        dag.num = num;
+        dag.start.assign(num + 1, 0);
+        std::vector<int> last(num, -1); // last[d] = 最後に d への辺を追加した成分
+        for (int c = 0; c < num; c++) {
+            for (int k = cstart[c]; k < cstart[c + 1]; k++) {
+                int v = member[k];
+                for (int i = start[v]; i < start[v + 1]; i++) {
+                    int d = ids[elist[i]];
+                    if (d == c || last[d] == c) continue;
+                    last[d] = c;
+                    dag.elist.push_back(d);
+                }
             }
-            rvs.push_back(v);
-        };
-
-        for (int i = _n - 1; i >= 0; i--) {
-            if (visited[vs[i]]) continue;
-            rvs.clear();
-            rdfs(rdfs, vs[i]);
-            scc.push_back(rvs);
+            dag.start[c + 1] = (int)dag.elist.size();
         }
-
-        return scc;
+        dag.id = std::move(ids);
+        return dag;
     }
 
     private:
     int _n;
-    std::vector<std::vector<int>> G;
-    std::vector<std::vector<int>> rG;
+    std::vector<std::pair<int,int>> edges; // add_edge で追加された辺 (from, to)
+
+    /*----------------------------------------------------------
+     - 関数名: scc_ids
+     - 機能  : CSR 形式のグラフに対して非再帰の Tarjan のアルゴリズムを実行する
+     - 引数  : start, elist : build_csr で作った隣接リスト
+     - 戻り値: (強連結成分の個数, 各頂点の強連結成分の番号 (トポロジカル順))
+     - 計算量: O(N + M)
+    ----------------------------------------------------------*/
+    std::pair<int, std::vector<int>> scc_ids(const std::vector<int>& start, const std::vector<int>& elist) const {
+        // ord[v] : 訪問順 (強連結成分が確定した頂点は _n にして low の計算から外す)
+        // low[v] : v から到達でき、まだ確定していない頂点の ord の最小値
+        int now_ord = 0, group_num = 0;
+        std::vector<int> ord(_n, -1), low(_n), ids(_n);
+        std::vector<int> it(start.begin(), start.end() - 1); // 次に調べる辺の位置
+        std::vector<int> visited, callstack;
+        visited.reserve(_n);
+        callstack.reserve(_n);
+
+        for (int s = 0; s < _n; s++) {
+            if (ord[s] != -1) continue;
+            ord[s] = low[s] = now_ord++;
+            visited.push_back(s);
+            callstack.push_back(s);
+
+            while (!callstack.empty()) {
+                int v = callstack.back();
+                bool descended = false;
+                while (it[v] < start[v + 1]) {
+                    int to = elist[it[v]++];
+                    if (ord[to] == -1) {
+                        // 再帰呼び出しの代わりに callstack に積む
+                        ord[to] = low[to] = now_ord++;
+                        visited.push_back(to);
+                        callstack.push_back(to);
+                        descended = true;
+                        break;
+                    }
+                    low[v] = std::min(low[v], ord[to]);
+                }
+                if (descended) continue;
+
+                // v の辺を全て調べ終えた (再帰呼び出しから戻る)
+                callstack.pop_back();
+                if (low[v] == ord[v]) {
+                    while (true) {
+                        int u = visited.back();
+                        visited.pop_back();
+                        ord[u] = _n;
+                        ids[u] = group_num;
+                        if (u == v) break;
+                    }
+                    group_num++;
+                }
+                if (!callstack.empty()) {
+                    int p = callstack.back();
+                    low[p] = std::min(low[p], low[v]);
+                }
+            }
+        }
+
+        // Tarjan のアルゴリズムではトポロジカル順の逆順に確定するので反転する
+        for (auto& x : ids) x = group_num - 1 - x;
+        return {group_num, ids};
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: build_csr
+     - 機能  : edges から CSR 形式の隣接リストを作る
+     - 引数  : start : v から出る辺は elist[start[v]] ... elist[start[v+1]-1]
+               elist : 辺の行き先を from の順に並べた配列
+     - 計算量: O(N + M)
+    ----------------------------------------------------------*/
+    void build_csr(std::vector<int>& start, std::vector<int>& elist) const {
+        start.assign(_n + 1, 0);
+        elist.resize(edges.size());
+        for (const auto& [from, to] : edges) start[from + 1]++;
+        for (int i = 0; i < _n; i++) start[i + 1] += start[i];
+        std::vector<int> pos(start.begin(), start.end() - 1);
+        for (const auto& [from, to] : edges) elist[pos[from]++] = to;
+    }
 };
\ No newline at end of file
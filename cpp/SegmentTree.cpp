@@ -47,6 +47,7 @@ class SegmentTree {
             return;
         }
         
+        PROF_COUNT("SegmentTree/set (nodes)", __builtin_ctz(_size) + 1);
         p += _size;
         data[p] = x;
         while(p >= 2) {
@@ -92,12 +93,15 @@ class SegmentTree {
         l += _size;
         r += _size;
 
+        PROF_ONLY(int nodes = 0;)
         while (l < r) {
+            PROF_ONLY(nodes += (l & 1) + (r & 1);)
             if (l & 1) vl = op(vl, data[l++]);
             if (r & 1) vr = op(data[--r], vr);
             l >>= 1;
             r >>= 1;
         }
+        PROF_COUNT("SegmentTree/prod (nodes)", nodes);
         return op(vl, vr);
     }
 
@@ -0,0 +1,71 @@
+/*----------------------------------------------------------
+ - クラス名  : TwoSat
+ - 機能      : 2-SAT (各節のリテラルが2個以下の充足可能性問題) を解く
+ - 備考      : SCC.cpp の SCC クラスが必要
+               変数 x_i の真偽を頂点 2i+1 (真) と 2i (偽) で表し、
+               節 (a ∨ b) を含意 ¬a → b、¬b → a の2本の辺にする
+               x_i と ¬x_i が同じ強連結成分に属さなければ充足可能で、
+               トポロジカル順で後ろにある方を真にすればよい
+ - 計算量    : 変数の個数を N、節の個数を M として O(N + M)
+ - 参考      : ac-library twosat.hpp
+ - 使用例    : TwoSat ts(3);
+               ts.add_clause(0, true, 1, false); // x_0 ∨ ¬x_1
+               ts.add_clause(1, true, 2, true);  // x_1 ∨ x_2
+               if (ts.satisfiable()) vector<bool> x = ts.answer();
+----------------------------------------------------------*/
+class TwoSat {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: TwoSat
+     - 機能  : コンストラクタ
+     - 引数  : int n : 変数の個数
+    ----------------------------------------------------------*/
+    TwoSat(int n) : _n(n), _answer(n), scc(2 * n) {}
+
+    /*----------------------------------------------------------
+     - 関数名: add_clause
+     - 機能  : 節 (x_i = f) ∨ (x_j = g) を追加する
+     - 引数  : int i, j : 変数の番号 (0 <= i,j < n)
+               bool f, g : 変数の値
+     - 戻り値: なし
+     - 計算量: O(1) (償却)
+    ----------------------------------------------------------*/
+    void add_clause(int i, bool f, int j, bool g) {
+        if (i < 0 || _n <= i || j < 0 || _n <= j) {
+            printf("[TwoSat] Error: argument of add_clause function is inappropriate.\n");
+            printf("i: %d, j: %d\n", i, j);
+            return;
+        }
+        scc.add_edge(2 * i + (f ? 0 : 1), 2 * j + (g ? 1 : 0));
+        scc.add_edge(2 * j + (g ? 0 : 1), 2 * i + (f ? 1 : 0));
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: satisfiable
+     - 機能  : 全ての節を同時に満たす割り当てが存在するかを返す
+     - 戻り値: bool : 充足可能なら true
+     - 備考  : 充足可能なら、割り当ての1つを answer で取得できる
+     - 計算量: O(N + M)
+    ----------------------------------------------------------*/
+    bool satisfiable() {
+        auto [num, id] = scc.scc_ids();
+        for (int i = 0; i < _n; i++) {
+            if (id[2 * i] == id[2 * i + 1]) return false;
+            _answer[i] = id[2 * i] < id[2 * i + 1];
+        }
+        return true;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: answer
+     - 機能  : 直前の satisfiable で求めた割り当てを返す
+     - 戻り値: answer[i] = x_i の値
+    ----------------------------------------------------------*/
+    std::vector<bool> answer() const { return _answer; }
+
+    private:
+    int _n;
+    std::vector<bool> _answer;
+    SCC scc;
+};
\ No newline at end of file
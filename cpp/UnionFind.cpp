@@ -1,6 +1,7 @@
 /*----------------------------------------------------------
  - クラス名  : UnionFind
  - 機能      : 根付き木のグループ分けを高速に行うデータ構造
+ - 備考      : NDEBUG を定義すると引数の範囲チェックを省略する (高速化用)
 ----------------------------------------------------------*/
 class UnionFind {
     public:
@@ -23,14 +24,16 @@ class UnionFind {
      - 使用例: uf.merge(2,3);
     ----------------------------------------------------------*/
     void merge(int a, int b) {
+#ifndef NDEBUG
         if (a < 0 || _n <= a || b < 0 || _n <= b) {
             printf("[UnionFind] Error: argument of merge function is inappropriate.\n");
             printf("a: %d, b: %d\n", a, b);
             return;
         }
+#endif
 
-        int root_a = root(a);
-        int root_b = root(b);
+        int root_a = _root(a);
+        int root_b = _root(b);
 
         // 既に同じ連結成分なら処理不要
         if (root_a == root_b) return;
@@ -53,12 +56,14 @@ class UnionFind {
      - 使用例: bool isSame = uf.same(2,3);
     ----------------------------------------------------------*/
     bool same(int a, int b) {
+#ifndef NDEBUG
         if (a < 0 || _n <= a || b < 0 || _n <= b) {
             printf("[UnionFind] Error: argument of same function is inappropriate.\n");
             printf("a: %d, b: %d\n", a, b);
             return false;
         }
-        return root(a) == root(b);
+#endif
+        return _root(a) == _root(b);
     }
 
     /*----------------------------------------------------------
@@ -66,20 +71,19 @@ class UnionFind {
      - 機能  : 頂点 a の根を返す
      - 引数  : int a : 調べる頂点 (0 <= a < n)
      - 戻り値: int : a の根
-     - 備考  : 経路圧縮を適用している
+     - 備考  : 経路圧縮 (経路半減) を非再帰で適用している
      - 計算量: O(alpha(n)) (alpha(n) はアッカーマンの逆関数)
      - 使用例: int root_x = uf.root(3);
     ----------------------------------------------------------*/
     int root(int a) {
+#ifndef NDEBUG
         if (a < 0 || _n <= a) {
             printf("[UnionFind] Error: argument of root function is inappropriate.\n");
             printf("a: %d\n", a);
             return -1;
         }
-        if (parent_or_size[a] < 0) return a;
-
-        // 経路圧縮: a から根までの頂点をつなぎ直しながら、戻り値を返す
-        return parent_or_size[a] = root(parent_or_size[a]);
+#endif
+        return _root(a);
     }
 
     /*----------------------------------------------------------
@@ -91,12 +95,14 @@ class UnionFind {
      - 使用例: int size_x = uf.root(3);
     ----------------------------------------------------------*/
     int size(int a) {
+#ifndef NDEBUG
         if (a < 0 || _n <= a) {
             printf("[UnionFind] Error: argument of size function is inappropriate.\n");
             printf("a: %d\n", a);
             return 0;
         }
-        return -parent_or_size[root(a)];
+#endif
+        return -parent_or_size[_root(a)];
     }
 
     /*----------------------------------------------------------
@@ -110,7 +116,7 @@ class UnionFind {
     std::vector<std::vector<int>> groups() {
         std::vector<int> root_buf(_n), group_size(_n);
         for (int i = 0; i < _n; i++) {
-            root_buf[i] = root(i);
+            root_buf[i] = _root(i);
             group_size[root_buf[i]]++;
         }
 
@@ -130,6 +136,57 @@ class UnionFind {
         return result;
     }
 
+    /*----------------------------------------------------------
+     - 構造体名: CSRGroups
+     - 機能    : groups_csr の戻り値
+     - 備考    : k 番目の連結成分の頂点は member[start[k]] ... member[start[k+1]-1]
+    ----------------------------------------------------------*/
+    struct CSRGroups {
+        std::vector<int> start;  // 各連結成分の先頭位置 (大きさは連結成分の個数 + 1)
+        std::vector<int> member; // 連結成分ごとに並べた頂点 (各成分内では昇順)
+        std::vector<int> id;     // id[v] = 頂点 v の属する連結成分の番号
+
+        int count() const { return (int)start.size() - 1; }
+    };
+
+    /*----------------------------------------------------------
+     - 関数名: groups_csr
+     - 機能  : 連結成分ごとの頂点の一覧を、2つの1次元配列で求める
+     - 引数  : なし
+     - 戻り値: CSRGroups (連結成分の番号は groups() の並びと同じ)
+     - 備考  : 計数ソートで並べるため、配列の確保は頂点数によらず定数回で済む
+               連結成分の番号の配列も同時に得られる
+     - 計算量: O(n alpha(n))
+     - 使用例: auto g = uf.groups_csr();
+               for (int k = 0; k < g.count(); k++) {
+                   for (int i = g.start[k]; i < g.start[k + 1]; i++) cout << g.member[i] << ' ';
+               }
+    ----------------------------------------------------------*/
+    CSRGroups groups_csr() {
+        CSRGroups g;
+        g.id.resize(_n);
+
+        // 根に番号を振る (根の頂点番号の昇順)
+        int k = 0;
+        for (int i = 0; i < _n; i++) {
+            if (parent_or_size[i] < 0) g.id[i] = k++;
+        }
+
+        // 各頂点に根の番号を配り、連結成分の大きさを数える
+        g.start.assign(k + 1, 0);
+        for (int i = 0; i < _n; i++) {
+            g.id[i] = g.id[_root(i)];
+            g.start[g.id[i] + 1]++;
+        }
+        for (int j = 0; j < k; j++) g.start[j + 1] += g.start[j];
+
+        // 計数ソートで頂点を並べる
+        g.member.resize(_n);
+        std::vector<int> pos(g.start.begin(), g.start.end() - 1);
+        for (int i = 0; i < _n; i++) g.member[pos[g.id[i]]++] = i;
+        return g;
+    }
+
     /*----------------------------------------------------------
      - 関数名: debug
      - 機能  : 生データを表示する
@@ -159,4 +216,27 @@ class UnionFind {
     int _n;
     std::vector<int> parent_or_size; // 親なら -(連結成分のサイズ)、子なら親の頂点
     const int DEBUG_MAX_LINE = 100;
+
+    /*----------------------------------------------------------
+     - 関数名: _root
+     - 機能  : 頂点 a の根を返す (範囲チェックなし)
+     - 備考  : 経路半減: 辿った頂点の親を祖父に付け替えながら根へ進む
+               再帰しないため、長い鎖でもスタックを消費しない
+     - 計算量: O(alpha(n))
+    ----------------------------------------------------------*/
+    int _root(int a) {
+        PROF_ONLY(int path = 0;)
+        while (parent_or_size[a] >= 0) {
+            int p = parent_or_size[a];
+            if (parent_or_size[p] < 0) {
+                PROF_COUNT("UnionFind/root (path length)", path + 1);
+                return p;
+            }
+            parent_or_size[a] = parent_or_size[p];
+            a = parent_or_size[p];
+            PROF_ONLY(path += 2;)
+        }
+        PROF_COUNT("UnionFind/root (path length)", path);
+        return a;
+    }
 };
\ No newline at end of file
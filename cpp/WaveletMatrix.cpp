@@ -0,0 +1,485 @@
+/*----------------------------------------------------------
+ - クラス名  : BitVector
+ - 機能      : rank (先頭から i 個のうちの 1 の個数) を O(1) で求めるビット列
+ - 備考      : 64 ビットの語ごとに、その語より前の 1 の個数 (rank の表) を並べて持ち、
+               語の中は popcount で数える。表は 1 ビットあたり 0.5 ビット
+               (語と表を1つの構造体に並べると、大きさが 16 バイトに揃えられて
+                キャッシュに載る量が減り、かえって遅かった)
+               select (k 番目の 1 の位置) は表の二分探索と語の中の走査で求める
+               set で全てのビットを立ててから build を呼ぶこと
+----------------------------------------------------------*/
+class BitVector {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: BitVector
+     - 機能  : コンストラクタ (全て 0)
+     - 引数  : int n : ビット数
+    ----------------------------------------------------------*/
+    explicit BitVector(int n = 0) : _n(n), bits((n >> 6) + 1, 0), cum((n >> 6) + 1, 0) {}
+
+    void set(int i) { bits[i >> 6] |= 1ULL << (i & 63); }
+    bool get(int i) const { return (bits[i >> 6] >> (i & 63)) & 1; }
+    int size() const { return _n; }
+
+    // rank の表を作る (set の後に1回呼ぶ)
+    void build() {
+        int c = 0;
+        for (int k = 0; k < (int)bits.size(); k++) {
+            cum[k] = c;
+            c += popcount(bits[k]);
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: rank1 / rank0
+     - 機能  : 半開区間 [0, i) の 1 / 0 の個数を返す
+     - 引数  : int i : 位置 (0 <= i <= size())
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    int rank1(int i) const { return cum[i >> 6] + popcount(bits[i >> 6] & ((1ULL << (i & 63)) - 1)); }
+    int rank0(int i) const { return i - rank1(i); }
+
+    /*----------------------------------------------------------
+     - 関数名: select1 / select0
+     - 機能  : k 番目 (0 始まり) の 1 / 0 の位置を返す
+     - 引数  : int k : 何番目か (k >= 0)
+     - 戻り値: int : 位置 (なければ -1)
+     - 計算量: O(log(n))
+    ----------------------------------------------------------*/
+    int select1(int k) const { return select<true>(k); }
+    int select0(int k) const { return select<false>(k); }
+
+    private:
+    int _n;
+    std::vector<uint64_t> bits;
+    std::vector<int> cum; // cum[k] : 語 0 .. k-1 の 1 の個数
+
+    // ハードウェアの popcnt が使えないとき、__builtin_popcountll はライブラリ関数の呼び出しになるので、
+    // ビット演算で数える (template.cpp の USE_AVX2 か -mpopcnt なら popcnt 命令)
+    static int popcount(uint64_t x) {
+#if defined(__POPCNT__) || defined(USE_AVX2)
+        return __builtin_popcountll(x);
+#else
+        x = x - ((x >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return (int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    template <bool One>
+    int select(int k) const {
+        const int total = One ? rank1(_n) : rank0(_n);
+        if (k < 0 || total <= k) return -1;
+        // 語 w より前の個数が k 以下となる最大の w
+        int lo = 0, hi = (int)bits.size();
+        while (hi - lo > 1) {
+            int mid = (lo + hi) / 2;
+            int c = One ? cum[mid] : 64 * mid - cum[mid];
+            if (c <= k) lo = mid;
+            else hi = mid;
+        }
+        k -= One ? cum[lo] : 64 * lo - cum[lo];
+        uint64_t x = One ? bits[lo] : ~bits[lo];
+        // 8 ビットずつ飛ばしてから 1 ビットずつ見る
+        int p = 0;
+        while (true) {
+            int c = popcount(x & 0xff);
+            if (k < c) break;
+            k -= c;
+            x >>= 8;
+            p += 8;
+        }
+        while (true) {
+            if ((x & 1) && k-- == 0) break;
+            x >>= 1;
+            p++;
+        }
+        return 64 * lo + p;
+    }
+};
+
+/*----------------------------------------------------------
+ - クラス名  : WaveletMatrix
+ - 機能      : 静的な整数列に対して、区間の k 番目に小さい値、x 未満の値の個数、
+               最頻値の上位 k 個などを O(log(σ)) で求める (σ は異なる値の個数)
+ - 備考      : 値を座標圧縮し、上位のビットから順に、そのビットが 0 の要素を前、
+               1 の要素を後ろに安定に並べ替えた列のビットを BitVector で持つ
+               メモリは n * log(σ) ビットと rank の表 (その半分) と値の表だけで、
+               ソート済みの列を持つセグメント木 (O(n log(n)) 語、k 番目は O(log^3(n))) より
+               小さく速い
+               RadixSort.cpp (Compressor) を先に貼ること
+ - パラメータ : class T : 値の型 (整数型)
+ - 計算量    : 構築 O(n log(σ))、各クエリ O(log(σ)) (select は O(log(σ) log(n)))
+ - 参考      : https://miti-7.hatenablog.com/entry/2018/04/28/152259
+ - 使用例    : WaveletMatrix<long long> wm(A);
+               wm.kth_smallest(l, r, k);       // [l, r) で k 番目 (0 始まり) に小さい値
+               wm.count_less(l, r, x);         // [l, r) で x 未満の値の個数
+               wm.range_freq(l, r, lo, hi);    // [l, r) で lo 以上 hi 未満の値の個数
+               wm.prev_value(l, r, x, -1);     // [l, r) で x 未満の最大の値 (なければ -1)
+               for (auto [v, c] : wm.topk(l, r, 3)) ... // [l, r) で個数の多い値の上位 3 個
+----------------------------------------------------------*/
+template <class T>
+class WaveletMatrix {
+    template <class, class>
+    friend class WaveletMatrixBIT;
+
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: WaveletMatrix
+     - 機能  : コンストラクタ
+     - 引数  : const vector<T>& xs : 値の列
+     - 計算量: O(n log(σ))
+    ----------------------------------------------------------*/
+    WaveletMatrix(const std::vector<T>& xs) : _n((int)xs.size()) {
+        Compressor<T> comp(xs);
+        vals = comp.values();
+        lg = 1;
+        while ((1 << lg) < (int)vals.size()) lg++;
+        bv.assign(lg, BitVector(_n));
+        zeros.assign(lg, 0);
+
+        std::vector<int> cur = comp.ids(), nxt(_n);
+        for (int h = lg - 1; h >= 0; h--) {
+            for (int i = 0; i < _n; i++) {
+                if ((cur[i] >> h) & 1) bv[h].set(i);
+            }
+            bv[h].build();
+            zeros[h] = bv[h].rank0(_n);
+            // ビットが 0 の要素を前、1 の要素を後ろに (安定に)
+            int p0 = 0, p1 = zeros[h];
+            for (int i = 0; i < _n; i++) {
+                if ((cur[i] >> h) & 1) nxt[p1++] = cur[i];
+                else nxt[p0++] = cur[i];
+            }
+            std::swap(cur, nxt);
+        }
+    }
+
+    int size() const { return _n; }
+
+    /*----------------------------------------------------------
+     - 関数名: access
+     - 機能  : i 番目の値を返す
+     - 引数  : int i : 位置 (0 <= i < n)
+     - 計算量: O(log(σ))
+    ----------------------------------------------------------*/
+    T access(int i) const {
+        if (i < 0 || _n <= i) {
+            printf("[WaveletMatrix] Error: argument of access function is inappropriate.\n");
+            printf("i: %d\n", i);
+            return T();
+        }
+        int c = 0;
+        for (int h = lg - 1; h >= 0; h--) {
+            if (bv[h].get(i)) {
+                c |= 1 << h;
+                i = zeros[h] + bv[h].rank1(i);
+            } else {
+                i = bv[h].rank0(i);
+            }
+        }
+        return vals[c];
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: rank
+     - 機能  : 半開区間 [0, r) にある値 x の個数を返す
+     - 引数  : T x   : 値
+               int r : 区間の右端 (0 <= r <= n)
+     - 計算量: O(log(σ))
+    ----------------------------------------------------------*/
+    int rank(const T& x, int r) const {
+        if (r < 0 || _n < r) {
+            printf("[WaveletMatrix] Error: argument of rank function is inappropriate.\n");
+            printf("r: %d\n", r);
+            return 0;
+        }
+        const int c = code(x);
+        if (c < 0) return 0;
+        int l = 0;
+        for (int h = lg - 1; h >= 0; h--) down(h, (c >> h) & 1, l, r);
+        return r - l;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: select
+     - 機能  : k 番目 (0 始まり) の値 x の位置を返す
+     - 引数  : T x   : 値
+               int k : 何番目か (k >= 0)
+     - 戻り値: int : 位置 (x が k + 1 個なければ -1)
+     - 備考  : 最下段の x の並びの先頭から k 個進み、上の段へ select でたどる
+     - 計算量: O(log(σ) log(n))
+    ----------------------------------------------------------*/
+    int select(const T& x, int k) const {
+        const int c = code(x);
+        if (c < 0 || k < 0) return -1;
+        int l = 0, r = _n;
+        for (int h = lg - 1; h >= 0; h--) down(h, (c >> h) & 1, l, r);
+        if (r - l <= k) return -1;
+        int p = l + k;
+        for (int h = 0; h < lg; h++) {
+            p = ((c >> h) & 1) ? bv[h].select1(p - zeros[h]) : bv[h].select0(p);
+        }
+        return p;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: kth_smallest
+     - 機能  : 半開区間 [l, r) で k 番目 (0 始まり) に小さい値を返す
+     - 引数  : int l, r : 区間の端点 (0 <= l < r <= n)
+               int k    : 何番目か (0 <= k < r - l)
+     - 計算量: O(log(σ))
+    ----------------------------------------------------------*/
+    T kth_smallest(int l, int r, int k) const {
+        if (l < 0 || r < l || _n < r || k < 0 || r - l <= k) {
+            printf("[WaveletMatrix] Error: argument of kth_smallest function is inappropriate.\n");
+            printf("l: %d, r: %d, k: %d\n", l, r, k);
+            return T();
+        }
+        int c = 0;
+        for (int h = lg - 1; h >= 0; h--) {
+            int z = bv[h].rank0(r) - bv[h].rank0(l);
+            if (k < z) {
+                down(h, 0, l, r);
+            } else {
+                k -= z;
+                c |= 1 << h;
+                down(h, 1, l, r);
+            }
+        }
+        return vals[c];
+    }
+
+    // 半開区間 [l, r) で k 番目 (0 始まり) に大きい値
+    T kth_largest(int l, int r, int k) const { return kth_smallest(l, r, r - l - 1 - k); }
+
+    /*----------------------------------------------------------
+     - 関数名: count_less
+     - 機能  : 半開区間 [l, r) で x 未満の値の個数を返す
+     - 引数  : int l, r : 区間の端点 (0 <= l <= r <= n)
+               T x      : 値 (列にない値でもよい)
+     - 計算量: O(log(σ))
+    ----------------------------------------------------------*/
+    int count_less(int l, int r, const T& x) const {
+        if (l < 0 || r < l || _n < r) {
+            printf("[WaveletMatrix] Error: argument of count_less function is inappropriate.\n");
+            printf("l: %d, r: %d\n", l, r);
+            return 0;
+        }
+        const int c = lower_code(x);
+        if (c >= (1 << lg)) return r - l;
+        int res = 0;
+        for (int h = lg - 1; h >= 0; h--) {
+            if ((c >> h) & 1) {
+                res += bv[h].rank0(r) - bv[h].rank0(l);
+                down(h, 1, l, r);
+            } else {
+                down(h, 0, l, r);
+            }
+        }
+        return res;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: range_freq
+     - 機能  : 半開区間 [l, r) で lower 以上 upper 未満の値の個数を返す
+     - 引数  : int l, r     : 区間の端点 (0 <= l <= r <= n)
+               T lower, upper : 値の範囲
+     - 計算量: O(log(σ))
+    ----------------------------------------------------------*/
+    int range_freq(int l, int r, const T& lower, const T& upper) const {
+        if (!(lower < upper)) return 0;
+        return count_less(l, r, upper) - count_less(l, r, lower);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: prev_value / next_value
+     - 機能  : 半開区間 [l, r) で x 未満の最大の値 / x 以上の最小の値を返す
+     - 引数  : int l, r : 区間の端点 (0 <= l <= r <= n)
+               T x      : 値
+               T none   : 該当する値がないときに返す値
+     - 計算量: O(log(σ))
+    ----------------------------------------------------------*/
+    T prev_value(int l, int r, const T& x, const T& none) const {
+        int k = count_less(l, r, x);
+        return k == 0 ? none : kth_smallest(l, r, k - 1);
+    }
+    T next_value(int l, int r, const T& x, const T& none) const {
+        int k = count_less(l, r, x);
+        return k == r - l ? none : kth_smallest(l, r, k);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: topk
+     - 機能  : 半開区間 [l, r) で個数の多い値を上位 k 個まで返す
+     - 引数  : int l, r : 区間の端点 (0 <= l <= r <= n)
+               int k    : 個数 (k >= 0)
+     - 戻り値: vector<pair<T, int>> : (値, 個数) の個数の降順 (同じ個数なら値の昇順)
+     - 備考  : 各段で区間の幅が大きいノードから優先度付きキューで開いていく
+               (子の幅は親の幅以下なので、最下段に着いた順に個数の降順になる)
+     - 計算量: O(k log(σ) log(k log(σ)))
+    ----------------------------------------------------------*/
+    std::vector<std::pair<T, int>> topk(int l, int r, int k) const {
+        std::vector<std::pair<T, int>> res;
+        if (l < 0 || r < l || _n < r || k < 0) {
+            printf("[WaveletMatrix] Error: argument of topk function is inappropriate.\n");
+            printf("l: %d, r: %d, k: %d\n", l, r, k);
+            return res;
+        }
+        // (幅, -値の上位ビット, 段, l, r)。幅が同じなら値の小さい方を先に開く
+        using Node = std::tuple<int, int, int, int, int>;
+        std::priority_queue<Node> pq;
+        if (l < r) pq.emplace(r - l, 0, lg, l, r);
+        while (!pq.empty() && (int)res.size() < k) {
+            auto [w, nc, h, nl, nr] = pq.top();
+            pq.pop();
+            if (h == 0) {
+                res.emplace_back(vals[-nc], w);
+                continue;
+            }
+            h--;
+            int l0 = nl, r0 = nr, l1 = nl, r1 = nr;
+            down(h, 0, l0, r0);
+            down(h, 1, l1, r1);
+            if (l0 < r0) pq.emplace(r0 - l0, nc, h, l0, r0);
+            if (l1 < r1) pq.emplace(r1 - l1, nc - (1 << h), h, l1, r1);
+        }
+        return res;
+    }
+
+    private:
+    int _n;
+    int lg;                   // 段数 (値の番号のビット数)
+    std::vector<T> vals;      // 圧縮した値の表
+    std::vector<BitVector> bv; // bv[h] : 上から見て h ビット目の段
+    std::vector<int> zeros;   // zeros[h] : 段 h の 0 の個数
+
+    // 段 h でビット b の側へ区間 [l, r) を移す
+    void down(int h, int b, int& l, int& r) const {
+        if (b) {
+            l = zeros[h] + bv[h].rank1(l);
+            r = zeros[h] + bv[h].rank1(r);
+        } else {
+            l = bv[h].rank0(l);
+            r = bv[h].rank0(r);
+        }
+    }
+
+    // x 以上の最小の値の番号 (なければ値の種類数)
+    int lower_code(const T& x) const { return (int)(std::lower_bound(vals.begin(), vals.end(), x) - vals.begin()); }
+
+    // x の番号 (列になければ -1)
+    int code(const T& x) const {
+        int c = lower_code(x);
+        return (c < (int)vals.size() && vals[c] == x) ? c : -1;
+    }
+};
+
+/*----------------------------------------------------------
+ - クラス名  : WaveletMatrixBIT
+ - 機能      : 各要素に重みを持たせ、区間 [l, r) で値が lower 以上 upper 未満の要素の
+               重みの和を求める (重みは1点ずつ変更できる。値は変えられない)
+ - 備考      : WaveletMatrix の各段の並べ替えた後の順で重みを BIT に載せる
+               値の上位ビットが x と一致する間に 0 の側へ分かれた部分の重みを足していく
+               RadixSort.cpp (Compressor)、BIT.cpp を先に貼ること
+ - パラメータ : class T : 値の型 (整数型)
+               class W : 重みの型
+ - 計算量    : 構築 O(n log(σ))、add と sum は O(log(σ) log(n))
+ - 使用例    : // 点 (X[i], Y[i]) に重み Wt[i]。X でソートしておき、x 座標の範囲は添字の範囲にする
+               WaveletMatrixBIT<long long, long long> wm(Y, Wt);
+               wm.sum(l, r, ylo, yhi);  // 添字 [l, r) で Y が [ylo, yhi) の点の重みの和
+               wm.add(i, 5);            // 点 i の重みに 5 を足す
+----------------------------------------------------------*/
+template <class T, class W>
+class WaveletMatrixBIT {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: WaveletMatrixBIT
+     - 機能  : コンストラクタ
+     - 引数  : const vector<T>& xs : 値の列
+               const vector<W>& ws : 重みの列 (xs と同じ長さ)
+    ----------------------------------------------------------*/
+    WaveletMatrixBIT(const std::vector<T>& xs, const std::vector<W>& ws) : wm(xs), base(std::max(1, (int)xs.size())) {
+        const int n = wm._n;
+        if ((int)ws.size() != n) {
+            printf("[WaveletMatrixBIT] Error: xs and ws must have the same length.\n");
+            printf("xs: %d, ws: %d\n", n, (int)ws.size());
+        }
+        bits.assign(wm.lg, BIT<W>(std::max(1, n)));
+        for (int i = 0; i < n && i < (int)ws.size(); i++) add(i, ws[i]);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: add
+     - 機能  : i 番目の要素の重みに w を足す
+     - 引数  : int i : 位置 (0 <= i < n)
+               W w   : 足す値
+     - 計算量: O(log(σ) log(n))
+    ----------------------------------------------------------*/
+    void add(int i, const W& w) {
+        if (i < 0 || wm._n <= i) {
+            printf("[WaveletMatrixBIT] Error: argument of add function is inappropriate.\n");
+            printf("i: %d\n", i);
+            return;
+        }
+        base.add(i, w);
+        for (int h = wm.lg - 1; h >= 0; h--) {
+            if (wm.bv[h].get(i)) i = wm.zeros[h] + wm.bv[h].rank1(i);
+            else i = wm.bv[h].rank0(i);
+            bits[h].add(i, w);
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: sum_less
+     - 機能  : 半開区間 [l, r) で値が x 未満の要素の重みの和を返す
+     - 引数  : int l, r : 区間の端点 (0 <= l <= r <= n)
+               T x      : 値
+     - 計算量: O(log(σ) log(n))
+    ----------------------------------------------------------*/
+    W sum_less(int l, int r, const T& x) {
+        if (l < 0 || r < l || wm._n < r) {
+            printf("[WaveletMatrixBIT] Error: argument of sum_less function is inappropriate.\n");
+            printf("l: %d, r: %d\n", l, r);
+            return W(0);
+        }
+        if (l == r) return W(0);
+        const int c = wm.lower_code(x);
+        if (c >= (1 << wm.lg)) return base.sum(l, r);
+        W res = 0;
+        for (int h = wm.lg - 1; h >= 0; h--) {
+            int l0 = wm.bv[h].rank0(l), r0 = wm.bv[h].rank0(r);
+            if ((c >> h) & 1) {
+                // 0 の側へ分かれた要素は全て x 未満
+                res += bits[h].sum(l0, r0);
+                wm.down(h, 1, l, r);
+            } else {
+                l = l0;
+                r = r0;
+            }
+        }
+        return res;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: sum
+     - 機能  : 半開区間 [l, r) で値が lower 以上 upper 未満の要素の重みの和を返す
+     - 計算量: O(log(σ) log(n))
+    ----------------------------------------------------------*/
+    W sum(int l, int r, const T& lower, const T& upper) {
+        if (!(lower < upper)) return W(0);
+        return sum_less(l, r, upper) - sum_less(l, r, lower);
+    }
+
+    // 値の問い合わせ (kth_smallest など) は元の WaveletMatrix で行う
+    const WaveletMatrix<T>& matrix() const { return wm; }
+
+    private:
+    WaveletMatrix<T> wm;
+    BIT<W> base;              // 元の順の重み (x が全ての値より大きいとき用)
+    std::vector<BIT<W>> bits; // bits[h] : 段 h で並べ替えた後の順の重み
+};
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*----------------------------------------------------------
+ - クラス名: WeightedUnionFind
+ - 機能    : 「x_b - x_a = w」という関係を管理し、差を高速に求める UnionFind
+ - 条件    : S は op について可換群であること
+             (op は結合律・交換律を満たし、単位元 e と逆元 inv が存在する)
+ - 備考    : 各頂点に親からの差 (ポテンシャル) を持たせる
+             矛盾する関係を merge しようとすると false を返す
+ - 使用例  : long long op(long long a, long long b) { return a + b; }
+             long long e() { return 0; }
+             long long inv(long long a) { return -a; }
+             WeightedUnionFind<long long, op, e, inv> uf(N);
+             uf.merge(0, 1, 5);       // x_1 - x_0 = 5
+             uf.merge(1, 2, 3);       // x_2 - x_1 = 3
+             cout << uf.diff(0, 2);   // 8
+             bool ok = uf.merge(0, 2, 7); // false (矛盾)
+----------------------------------------------------------*/
+template <class S, S (*op)(S, S), S (*e)(), S (*inv)(S)>
+class WeightedUnionFind {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: WeightedUnionFind
+     - 機能  : コンストラクタ
+     - 引数  : int n : 頂点の数 (n >= 1)
+    ----------------------------------------------------------*/
+    WeightedUnionFind(int n) : _n(n), parent_or_size(n, -1), diff_parent(n, e()) {}
+
+    /*----------------------------------------------------------
+     - 関数名: merge
+     - 機能  : x_b - x_a = w という関係を追加する
+     - 引数  : int a, b : 2頂点 (0 <= a,b < n)
+               S w : x_b - x_a の値
+     - 戻り値: bool : 既存の関係と矛盾するなら false (このとき何も変更しない)
+     - 備考  : Union by Size を適用している
+     - 計算量: O(alpha(n))
+    ----------------------------------------------------------*/
+    bool merge(int a, int b, S w) {
+        if (a < 0 || _n <= a || b < 0 || _n <= b) {
+            printf("[WeightedUnionFind] Error: argument of merge function is inappropriate.\n");
+            printf("a: %d, b: %d\n", a, b);
+            return false;
+        }
+
+        int root_a = root(a);
+        int root_b = root(b);
+
+        // x_rb - x_ra = w + (x_a - x_ra) - (x_b - x_rb)
+        S d = op(op(w, diff_parent[a]), inv(diff_parent[b]));
+        if (root_a == root_b) return d == e();
+
+        // 頂点数の多い連結成分へ併合する (向きが逆になるなら差も反転する)
+        if (-parent_or_size[root_a] < -parent_or_size[root_b]) {
+            std::swap(root_a, root_b);
+            d = inv(d);
+        }
+        parent_or_size[root_a] += parent_or_size[root_b];
+        parent_or_size[root_b] = root_a;
+        diff_parent[root_b] = d;
+        return true;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: same
+     - 機能  : 頂点 a、b が同じ連結成分に属するか (差が定まるか) を返す
+     - 引数  : int a, b : 調べる2頂点 (0 <= a,b < n)
+     - 計算量: O(alpha(n))
+    ----------------------------------------------------------*/
+    bool same(int a, int b) {
+        if (a < 0 || _n <= a || b < 0 || _n <= b) {
+            printf("[WeightedUnionFind] Error: argument of same function is inappropriate.\n");
+            printf("a: %d, b: %d\n", a, b);
+            return false;
+        }
+        return root(a) == root(b);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: diff
+     - 機能  : x_b - x_a を返す
+     - 引数  : int a, b : 同じ連結成分に属する2頂点
+     - 戻り値: S : x_b - x_a (異なる連結成分なら e())
+     - 計算量: O(alpha(n))
+    ----------------------------------------------------------*/
+    S diff(int a, int b) {
+        if (!same(a, b)) {
+            printf("[WeightedUnionFind] Error: a and b are not in the same group.\n");
+            printf("a: %d, b: %d\n", a, b);
+            return e();
+        }
+        return op(diff_parent[b], inv(diff_parent[a]));
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: weight
+     - 機能  : x_a - x_(a の根) を返す
+     - 引数  : int a : 調べる頂点 (0 <= a < n)
+     - 計算量: O(alpha(n))
+    ----------------------------------------------------------*/
+    S weight(int a) {
+        root(a);
+        return diff_parent[a];
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: root
+     - 機能  : 頂点 a の根を返す
+     - 引数  : int a : 調べる頂点 (0 <= a < n)
+     - 備考  : 非再帰の経路圧縮を行い、圧縮した頂点の差を根からの差に更新する
+               (呼び出し後は diff_parent[a] = x_a - x_root となる)
+     - 計算量: O(alpha(n))
+    ----------------------------------------------------------*/
+    int root(int a) {
+        // a から根の直前までの頂点を記録する
+        path.clear();
+        int r = a;
+        while (parent_or_size[r] >= 0) {
+            path.push_back(r);
+            r = parent_or_size[r];
+        }
+
+        // 根に近い頂点から順に、差を根からの差に置き換えて根につなぎ直す
+        for (int i = (int)path.size() - 2; i >= 0; i--) {
+            int v = path[i];
+            diff_parent[v] = op(diff_parent[v], diff_parent[parent_or_size[v]]);
+            parent_or_size[v] = r;
+        }
+        return r;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: size
+     - 機能  : 頂点 a の属する連結成分の大きさを返す
+     - 引数  : int a : 調べる頂点 (0 <= a < n)
+     - 計算量: O(alpha(n))
+    ----------------------------------------------------------*/
+    int size(int a) { return -parent_or_size[root(a)]; }
+
+    private:
+    int _n;
+    std::vector<int> parent_or_size; // 親なら -(連結成分のサイズ)、子なら親の頂点
+    std::vector<S> diff_parent;      // x_v - x_(v の親)
+    std::vector<int> path;           // root で使う作業領域
+};
\ No newline at end of file
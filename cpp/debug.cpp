@@ -1,18 +1,132 @@
-template<typename T>
-void printArray(const std::vector<T>& arr) {
+// 出力先は既定で cerr。第2引数に cout や fout (FastIO.cpp) を渡すとそちらに書く
+template<typename T, typename Out = std::ostream>
+void printArray(const std::vector<T>& arr, Out& out = std::cerr) {
     for (const auto& element : arr) {
-        std::cerr << element << " ";
+        out << element << " ";
     }
-    std::cerr << '\n';
+    out << '\n';
 }
 
-template<typename T>
-void printMatrix(const std::vector<std::vector<T>>& matrix, bool useDelimiter = true, const char delimiter = ' ') {
+template<typename T, typename Out = std::ostream>
+void printMatrix(const std::vector<std::vector<T>>& matrix, bool useDelimiter = true, const char delimiter = ' ', Out& out = std::cerr) {
     for (const auto& row : matrix) {
         for (const auto& element : row) {
-            std::cerr << element;
-            if (useDelimiter) std::cerr << delimiter;
+            out << element;
+            if (useDelimiter) out << delimiter;
         }
-        std::cerr << '\n';
+        out << '\n';
     }
-}
\ No newline at end of file
+}
+
+/*----------------------------------------------------------
+ - 機能      : 計測 (PROFILE を定義したときだけ有効)
+ - 備考      : PROF_SCOPE(name)    : そのブロックを抜けるまでの時間を name に足す
+               PROF_COUNT(name, k) : name の呼び出し回数を 1、合計を k 増やす
+               PROF_ONLY(...)      : PROFILE のときだけ残す文 (PROF_COUNT に渡す値の計算用)
+               同じ name の計測は1つにまとめ、プログラムの終了時に cerr に一覧を出す
+               (平均 = 合計 / 呼び出し回数)
+               時間は x86 では rdtsc で測り、終了時に steady_clock と比べて ns に換算する
+               PROFILE を定義しないときは template.cpp で空のマクロになり、何も残らない
+               UnionFind、SegmentTree、BIT は主な操作に PROF_COUNT を入れてある
+ - 使用例    : #define PROFILE  (template.cpp の先頭)
+               void solve() {
+                   PROF_SCOPE("solve");
+                   ...
+               }
+               // 終了時に
+               // [profile] name                          calls          total          avg
+               // [profile] SegmentTree/prod (nodes)    200000        6043200        30.22
+               // [profile] solve (ns)                       1      153254311  153254311.00
+----------------------------------------------------------*/
+#ifdef PROFILE
+namespace prof {
+
+struct Counter {
+    std::string name;
+    bool timer;            // true なら total は rdtsc のカウント
+    long long calls = 0;
+    long long total = 0;
+};
+
+inline unsigned long long ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return (unsigned long long)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+struct Clock {
+    unsigned long long tick;
+    std::chrono::steady_clock::time_point time;
+};
+
+inline void report();
+
+// 終了時に解放されないよう new で確保する (他のグローバル変数のデストラクタからも使える)
+inline std::vector<Counter*>& registry() {
+    static std::vector<Counter*>* r = [] {
+        std::atexit(report);
+        return new std::vector<Counter*>();
+    }();
+    return *r;
+}
+
+inline const Clock& start_clock() {
+    static const Clock c{ticks(), std::chrono::steady_clock::now()};
+    return c;
+}
+
+inline Counter& counter(const char* name, bool timer = false) {
+    start_clock();
+    for (Counter* c : registry()) {
+        if (c->name == name && c->timer == timer) return *c;
+    }
+    registry().push_back(new Counter{name, timer});
+    return *registry().back();
+}
+
+class ScopedTimer {
+    public:
+    explicit ScopedTimer(Counter& c) : _c(c), _start(ticks()) {}
+    ~ScopedTimer() {
+        _c.calls++;
+        _c.total += (long long)(ticks() - _start);
+    }
+
+    private:
+    Counter& _c;
+    unsigned long long _start;
+};
+
+inline void report() {
+    // rdtsc のカウントを ns に換算する比
+    unsigned long long t = ticks();
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_clock().time).count();
+    double ns_per_tick = (t > start_clock().tick ? ns / (double)(t - start_clock().tick) : 1.0);
+
+    fprintf(stderr, "[profile] %-36s %12s %16s %16s\n", "name", "calls", "total", "avg");
+    for (const Counter* c : registry()) {
+        double total = (c->timer ? c->total * ns_per_tick : (double)c->total);
+        std::string name = (c->timer ? c->name + " (ns)" : c->name);
+        fprintf(stderr, "[profile] %-36s %12lld %16.0f %16.2f\n", name.c_str(), c->calls, total,
+                c->calls > 0 ? total / c->calls : 0.0);
+    }
+}
+
+} // namespace prof
+
+#define PROF_CONCAT_(a, b) a##b
+#define PROF_CONCAT(a, b) PROF_CONCAT_(a, b)
+// 名前から Counter を探すのは各呼び出し箇所で最初の1回だけ
+#define PROF_SCOPE(name) \
+    static prof::Counter& PROF_CONCAT(prof_counter_, __LINE__) = prof::counter(name, true); \
+    prof::ScopedTimer PROF_CONCAT(prof_timer_, __LINE__)(PROF_CONCAT(prof_counter_, __LINE__))
+#define PROF_COUNT(name, k) \
+    do { \
+        static prof::Counter& prof_counter_ = prof::counter(name); \
+        prof_counter_.calls++; \
+        prof_counter_.total += (k); \
+    } while (0)
+#define PROF_ONLY(...) __VA_ARGS__
+#endif
\ No newline at end of file
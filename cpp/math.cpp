@@ -80,7 +80,7 @@ T safe_mod(T x, U m) {
  -         m: mod演算の除数
  - 戻り値: (a ^ b) % m
 ----------------------------------------------------------*/
-long long Power(long long a, long long b, long long m)
+constexpr long long Power(long long a, long long b, long long m)
 {
     long long p = a, ans = 1;
     while (b > 0) {
@@ -172,6 +172,67 @@ long long Combination(long long n, long long r, long long m)
     return ans;
 }
 
+/*----------------------------------------------------------
+ - クラス名  : StaticCombination
+ - 機能      : 階乗とその逆元のテーブルをコンパイル時に構築し、nCr を O(1) で返す
+ - パラメータ : long long MOD : mod演算の除数で素数 (MOD > N)
+               int N : テーブルの最大値 (1e5 程度まで)
+ - 備考      : constexpr 変数として名前空間スコープに置くと、実行時の構築が不要になる
+               N = 1e5 なら g++ の既定の評価回数上限 (2^25 回) に収まり、オプションは不要
+               (コンパイル時間は 10 秒ほど増える)。N = 2e5 では上限を超えるので
+               -fconstexpr-ops-limit=... で上限を上げること
+ - 使用例    : constexpr StaticCombination<998244353, 100000> comb;
+               cout << comb(5, 2) << endl; // 10
+----------------------------------------------------------*/
+template <long long MOD, int N>
+class StaticCombination {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: StaticCombination
+     - 機能  : コンストラクタ
+     - 備考  : fact[N] の逆元だけを Power で求め、残りは漸化式で求める
+     - 計算量: O(N + logMOD) (コンパイル時)
+    ----------------------------------------------------------*/
+    constexpr StaticCombination() : _fact(), _inv_fact() {
+        _fact[0] = 1;
+        for (int i = 1; i <= N; i++) _fact[i] = _fact[i - 1] * i % MOD;
+        _inv_fact[N] = Power(_fact[N], MOD - 2, MOD);
+        for (int i = N; i >= 1; i--) _inv_fact[i - 1] = _inv_fact[i] * i % MOD;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: operator()
+     - 機能  : nCr を MOD で割った余りを返す
+     - 引数  : int n, r : 整数 (0 <= n <= N)
+     - 戻り値: nCr % MOD (r < 0 または r > n なら 0)
+     - 計算量: O(1)
+     - 備考  : Combination(n, r, MOD) と同じ値を返す
+    ----------------------------------------------------------*/
+    constexpr long long operator()(int n, int r) const {
+        if (r < 0 || n < r || n < 0 || N < n) return 0;
+        return _fact[n] * _inv_fact[r] % MOD * _inv_fact[n - r] % MOD;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: fact
+     - 機能  : n! を MOD で割った余りを返す
+     - 引数  : int n : 整数 (0 <= n <= N)
+    ----------------------------------------------------------*/
+    constexpr long long fact(int n) const { return _fact[n]; }
+
+    /*----------------------------------------------------------
+     - 関数名: inv_fact
+     - 機能  : 1 / n! を MOD で割った余りを返す
+     - 引数  : int n : 整数 (0 <= n <= N)
+    ----------------------------------------------------------*/
+    constexpr long long inv_fact(int n) const { return _inv_fact[n]; }
+
+    private:
+    std::array<long long, N + 1> _fact;     // n! % MOD
+    std::array<long long, N + 1> _inv_fact; // (1 / n!) % MOD
+};
+
 long long baseN_to_long(const std::string& x, const long long n) {
     long long ans = 0, p = 1;
     int m = (int)x.size();
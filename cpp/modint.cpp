@@ -21,7 +21,7 @@ template<int MOD, std::enable_if_t<(1 <= MOD && MOD <= INT32_MAX)>* = nullptr> s
      - 使用例: modint<7> a(9);
               cout << a.val() << endl; // 2
     ----------------------------------------------------------*/
-    constexpr modint(long long v) {
+    constexpr modint(long long v) : _v(0) {
         long long p = v % umod();
         if (p < 0) p += umod();
         _v = (unsigned int)(p);
@@ -39,7 +39,7 @@ template<int MOD, std::enable_if_t<(1 <= MOD && MOD <= INT32_MAX)>* = nullptr> s
      - 機能  : mod演算の演算結果を返す関数
      - 戻り値: long long _v : mod演算の演算結果
     ----------------------------------------------------------*/
-    long long val() const { return _v; }
+    constexpr long long val() const { return _v; }
 
     /*----------------------------------------------------------
      - 機能  : 前置形の++演算子のオーバーロード
@@ -136,7 +136,7 @@ template<int MOD, std::enable_if_t<(1 <= MOD && MOD <= INT32_MAX)>* = nullptr> s
                modint<MOD> b = MOD - 1;
                modint<MOD> c = a * b;   // c.val() = 1
     ----------------------------------------------------------*/
-    friend modint operator*(const modint& lhs, const modint& rhs) {
+    friend constexpr modint operator*(const modint& lhs, const modint& rhs) {
         return modint(lhs) *= rhs;
     }
 
@@ -299,4 +299,44 @@ template<int MOD, std::enable_if_t<(1 <= MOD && MOD <= INT32_MAX)>* = nullptr> s
     static constexpr unsigned int umod() { return MOD; }
 };
 using modint998244353  = modint<998244353>;
-using modint1000000007 = modint<1000000007>;
\ No newline at end of file
+using modint1000000007 = modint<1000000007>;
+
+/*----------------------------------------------------------
+ - クラス名  : StaticPowerTable
+ - 機能      : base^0, base^1, ..., base^N のテーブルをコンパイル時に構築する
+ - パラメータ : class mint : modint 型
+               int N : テーブルの最大の指数 (1e5 程度まで)
+ - 備考      : constexpr 変数として名前空間スコープに置くと、実行時の構築が不要になる
+               ローリングハッシュの基数の累乗などに用いる
+               N = 1e5 なら g++ の既定の評価回数上限に収まるが、コンパイル時間は 4 秒ほど増える
+ - 使用例    : constexpr StaticPowerTable<modint998244353, 100000> pw2(2);
+               cout << pw2.pow(10).val() << endl; // 1024
+----------------------------------------------------------*/
+template <class mint, int N>
+class StaticPowerTable {
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: StaticPowerTable
+     - 機能  : コンストラクタ
+     - 引数  : long long base : 底
+     - 計算量: O(N) (コンパイル時)
+    ----------------------------------------------------------*/
+    constexpr StaticPowerTable(long long base) : table() {
+        mint b(base);
+        table[0] = mint(1);
+        for (int i = 1; i <= N; i++) table[i] = table[i - 1] * b;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: pow
+     - 機能  : base の n 乗を返す
+     - 引数  : long long n : 指数 (0 <= n <= N)
+     - 備考  : mint(base).pow(n) と同じ値を返す
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    constexpr mint pow(long long n) const { return table[n]; }
+
+    private:
+    std::array<mint, N + 1> table; // table[i] = base^i
+};
\ No newline at end of file
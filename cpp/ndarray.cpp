@@ -0,0 +1,168 @@
+/*----------------------------------------------------------
+ - クラス名  : ndarray
+ - 機能      : 次元数を固定した多次元配列 (vvi, vvvl などの代わり)
+ - パラメータ : class T : 要素の型
+               int Rank : 次元数
+               size_t Align : 先頭のアラインメント (既定値 64 = キャッシュライン)
+ - 備考      : 全ての要素を1つの連続した領域に行優先で並べる
+               vector<vector<vector<T>>> は 200x200x200 で 40,000 回のメモリ確保と
+               アクセスのたびのポインタの参照が必要になるが、これは確保1回、
+               アクセスは添字の積和だけで済む
+               Arena を渡すとその Arena から領域を切り出す (解放は Arena に任せる)
+               vector の operator[] と同じく、_GLIBCXX_ASSERTIONS (_GLIBCXX_DEBUG) を
+               定義したときだけ添字の範囲をチェックし、範囲外なら終了する
+               Arena.cpp を先に貼ること
+ - 使用例    : ndarray<long long, 3> dp(N + 1, M + 1, K + 1); // 全て 0
+               dp.fill(LINF);
+               dp(0, 0, 0) = 0;
+               dp(i + 1, j, k) = min(dp(i + 1, j, k), dp(i, j, k) + c);
+
+               // 1つ前の層だけを使う DP (swap は O(1))
+               ndarray<int, 2> cur(H, W), nxt(H, W);
+               rep(t, T) { ...; swap(cur, nxt); }
+----------------------------------------------------------*/
+template <class T, int Rank, size_t Align = 64>
+class ndarray {
+    static_assert(Rank >= 1, "Rank must be positive");
+    static constexpr size_t ALIGN = (Align > alignof(T) ? Align : alignof(T));
+
+    public:
+
+    /*----------------------------------------------------------
+     - 関数名: ndarray
+     - 機能  : コンストラクタ (要素は T() で初期化する)
+     - 引数  : Dims... dims : 各次元の大きさ (Rank 個、0 以上)
+     - 使用例: ndarray<int, 2> a(H, W);
+    ----------------------------------------------------------*/
+    template <class... Dims, std::enable_if_t<sizeof...(Dims) == Rank && std::conjunction<std::is_integral<Dims>...>::value>* = nullptr>
+    explicit ndarray(Dims... dims) : ndarray(nullptr, std::array<int, Rank>{(int)dims...}) {}
+
+    /*----------------------------------------------------------
+     - 関数名: ndarray
+     - 機能  : コンストラクタ (Arena から領域を切り出す)
+     - 引数  : Arena& arena : 領域を切り出す Arena
+               Dims... dims : 各次元の大きさ (Rank 個)
+     - 備考  : arena を reset した後はこの配列を使ってはならない
+    ----------------------------------------------------------*/
+    template <class... Dims, std::enable_if_t<sizeof...(Dims) == Rank && std::conjunction<std::is_integral<Dims>...>::value>* = nullptr>
+    ndarray(Arena& arena, Dims... dims) : ndarray(&arena, std::array<int, Rank>{(int)dims...}) {}
+
+    /*----------------------------------------------------------
+     - 関数名: ndarray
+     - 機能  : コンストラクタ (要素を init で初期化する)
+     - 引数  : const array<int, Rank>& shape : 各次元の大きさ
+               const T& init : 初期値
+     - 使用例: ndarray<long long, 2> dist({H, W}, LINF);
+    ----------------------------------------------------------*/
+    ndarray(const std::array<int, Rank>& shape, const T& init) : ndarray(nullptr, shape, false) {
+        std::uninitialized_fill_n(_data, _size, init);
+    }
+
+    ndarray(const ndarray& other) : ndarray(other._arena, other._shape, false) {
+        std::uninitialized_copy_n(other._data, _size, _data);
+    }
+
+    ndarray(ndarray&& other) noexcept : _shape(other._shape), _size(other._size), _data(other._data), _arena(other._arena) {
+        other._shape.fill(0);
+        other._size = 0;
+        other._data = nullptr;
+    }
+
+    // コピーしてから交換する (ムーブなら O(1))
+    ndarray& operator=(ndarray other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~ndarray() {
+        if (_data == nullptr) return;
+        if constexpr (!std::is_trivially_destructible<T>::value) std::destroy_n(_data, _size);
+        if (_arena == nullptr) ::operator delete(_data, std::align_val_t(ALIGN));
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: operator()
+     - 機能  : 要素への参照を返す
+     - 引数  : Is... is : 各次元の添字 (Rank 個、0 <= is[k] < dim(k))
+     - 計算量: O(Rank)
+     - 使用例: dp(i, j, k) = 0;
+    ----------------------------------------------------------*/
+    template <class... Is>
+    T& operator()(Is... is) { return _data[offset(is...)]; }
+
+    template <class... Is>
+    const T& operator()(Is... is) const { return _data[offset(is...)]; }
+
+    /*----------------------------------------------------------
+     - 関数名: fill
+     - 機能  : 全ての要素を x にする
+     - 計算量: O(size)
+    ----------------------------------------------------------*/
+    void fill(const T& x) { std::fill(_data, _data + _size, x); }
+
+    /*----------------------------------------------------------
+     - 関数名: swap
+     - 機能  : other と中身を交換する
+     - 計算量: O(1)
+    ----------------------------------------------------------*/
+    void swap(ndarray& other) noexcept {
+        std::swap(_shape, other._shape);
+        std::swap(_size, other._size);
+        std::swap(_data, other._data);
+        std::swap(_arena, other._arena);
+    }
+
+    friend void swap(ndarray& a, ndarray& b) noexcept { a.swap(b); }
+
+    int dim(int k) const { return _shape[k]; }
+    size_t size() const { return _size; }
+    T* data() { return _data; }
+    const T* data() const { return _data; }
+    T* begin() { return _data; }
+    T* end() { return _data + _size; }
+    const T* begin() const { return _data; }
+    const T* end() const { return _data + _size; }
+
+    private:
+    std::array<int, Rank> _shape;
+    size_t _size;
+    T* _data;
+    Arena* _arena; // nullptr なら自分で確保した領域
+
+    // 領域を確保する (construct が true なら要素を T() で初期化する)
+    ndarray(Arena* arena, const std::array<int, Rank>& shape, bool construct = true) : _shape(shape), _size(1), _arena(arena) {
+        for (int k = 0; k < Rank; k++) {
+            if (shape[k] < 0) {
+                printf("[ndarray] Error: argument of constructor is inappropriate.\n");
+                printf("dim(%d): %d\n", k, shape[k]);
+                _shape[k] = 0;
+            }
+            _size *= (size_t)_shape[k];
+        }
+        if (_arena != nullptr) _data = (T*)_arena->allocate(_size * sizeof(T), ALIGN);
+        else _data = (T*)::operator new(_size * sizeof(T), std::align_val_t(ALIGN));
+        if (construct) std::uninitialized_value_construct_n(_data, _size);
+    }
+
+    // 範囲外の添字を報告して終了する (ホットパスに入らないよう別の関数にする)
+    [[noreturn]] __attribute__((noinline, cold)) void out_of_range(const int* idx) const {
+        printf("[ndarray] Error: index is out of range.\n");
+        for (int k = 0; k < Rank; k++) printf("index(%d): %d, dim(%d): %d\n", k, idx[k], k, _shape[k]);
+        std::exit(1);
+    }
+
+    // 行優先の位置 ((i0 * d1 + i1) * d2 + i2) ...
+    template <class... Is>
+    size_t offset(Is... is) const {
+        static_assert(sizeof...(Is) == Rank, "number of indices must be Rank");
+        const int idx[] = {(int)is...};
+        size_t p = 0;
+        for (int k = 0; k < Rank; k++) {
+#ifdef _GLIBCXX_ASSERTIONS
+            if (__builtin_expect((unsigned)idx[k] >= (unsigned)_shape[k], 0)) out_of_range(idx);
+#endif
+            p = p * _shape[k] + idx[k];
+        }
+        return p;
+    }
+};
\ No newline at end of file
@@ -53,20 +53,257 @@ class SieveOfEratosthenes {
      - 計算量: O(logn) 
     ----------------------------------------------------------*/
     std::vector<int> factorize(int x) {
-        std::vector<int> result;
         if (x < 2 || _n < x) {
             std::cout << "[SieveOfEratosthenes] Error: argument of factorize is inappropriate." << std::endl;
-            return result;
+            return std::vector<int>();
+        }
+        return factorize_spf(factor.data(), x);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: factorize
+     - 機能  : 値 x を素因数分解し、(素数, 指数) の組を呼び出し側のバッファに書き込む
+     - 引数  : int x : 調べる値 (1 <= x <= n)
+               std::pair<int,int>* out : 書き込み先 (MAX_DISTINCT_PRIMES 個以上の領域)
+     - 戻り値: 書き込んだ組の個数 (x = 1 なら 0)
+     - 備考  : out[i].first < out[i+1].first が成立
+               ヒープ確保を行わないため、大量の値を分解するときに用いる
+     - 計算量: O(logn)
+     - 使用例: std::pair<int,int> pe[SieveOfEratosthenes::MAX_DISTINCT_PRIMES];
+               int k = se.factorize(360, pe); // k = 3, pe = {(2,3), (3,2), (5,1)}
+    ----------------------------------------------------------*/
+    int factorize(int x, std::pair<int,int>* out) const {
+        if (x < 1 || _n < x) {
+            printf("[SieveOfEratosthenes] Error: argument of factorize function is inappropriate.\n");
+            printf("x: %d\n", x);
+            return 0;
+        }
+        return factorize_spf(factor.data(), x, out);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: factorize
+     - 機能  : 値 x を素因数分解し、(素数, 指数) の組を配列 out に格納する
+     - 引数  : int x : 調べる値 (1 <= x <= n)
+               std::vector<std::pair<int,int>>& out : 格納先 (中身は上書きされる)
+     - 戻り値: 格納した組の個数
+     - 備考  : out を使い回せば、確保済みの容量が再利用されるため再確保は起きない
+     - 計算量: O(logn)
+     - 使用例: std::vector<std::pair<int,int>> pe;
+               for (int x = 1; x <= N; x++) se.factorize(x, pe);
+    ----------------------------------------------------------*/
+    int factorize(int x, std::vector<std::pair<int,int>>& out) const {
+        std::pair<int,int> buf[MAX_DISTINCT_PRIMES];
+        int k = factorize(x, buf);
+        out.assign(buf, buf + k);
+        return k;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: for_each_divisor
+     - 機能  : 値 x の約数全てについて f(d) を呼び出す
+     - 引数  : int x : 調べる値 (1 <= x <= n)
+               F f   : 約数 d を受け取る関数 (void(int))
+     - 戻り値: なし
+     - 備考  : 約数は昇順とは限らない (1 が最初に呼ばれる)
+               中間の配列を作らず、指数の組を繰り上げながら列挙する
+     - 計算量: O(logn + d(x)) (d(x) は x の約数の個数)
+     - 使用例: long long sum = 0;
+               se.for_each_divisor(12, [&](int d) { sum += d; }); // sum = 28
+    ----------------------------------------------------------*/
+    template <class F>
+    void for_each_divisor(int x, F f) const {
+        if (x < 1 || _n < x) {
+            printf("[SieveOfEratosthenes] Error: argument of for_each_divisor function is inappropriate.\n");
+            printf("x: %d\n", x);
+            return;
         }
+        for_each_divisor_spf(factor.data(), x, f);
+    }
 
-        while(x != 1) {
+    // int の範囲の値が持つ相異なる素因数の個数の最大値 (2*3*5*...*23 < 2^31 < 2*3*5*...*29)
+    static constexpr int MAX_DISTINCT_PRIMES = 9;
+
+    /*----------------------------------------------------------
+     - 関数名: factorize_spf / for_each_divisor_spf
+     - 機能  : 最小の素因数の表 factor (factor[y] は y の最小の素因数) を使って、
+               factorize / for_each_divisor と同じことを行う
+     - 引数  : const int* factor : 最小の素因数の表 (x までの値があること)
+               int x : 調べる値 (factorize_spf(factor, x) は x >= 2、他は x >= 1)
+     - 備考  : 範囲の確認は行わない
+               SieveOfEratosthenes と StaticSieve が表の持ち方によらず共有する実装
+    ----------------------------------------------------------*/
+    static std::vector<int> factorize_spf(const int* factor, int x) {
+        std::vector<int> result;
+        while (x != 1) {
             result.push_back(factor[x]);
             x /= factor[x];
         }
         return result;
     }
 
+    static int factorize_spf(const int* factor, int x, std::pair<int,int>* out) {
+        int k = 0;
+        while (x != 1) {
+            int p = factor[x], e = 0;
+            do {
+                x /= p;
+                e++;
+            } while (factor[x] == p);
+            out[k++] = std::make_pair(p, e);
+        }
+        return k;
+    }
+
+    template <class F>
+    static void for_each_divisor_spf(const int* factor, int x, F f) {
+        std::pair<int,int> pe[MAX_DISTINCT_PRIMES];
+        const int k = factorize_spf(factor, x, pe);
+
+        int e[MAX_DISTINCT_PRIMES] = {}, pw[MAX_DISTINCT_PRIMES];
+        for (int i = 0; i < k; i++) pw[i] = 1;
+
+        int d = 1;
+        while (true) {
+            f(d);
+
+            // 指数の組 e を 1 つ進める (繰り上がった桁は指数 0 に戻す)
+            int i = 0;
+            while (i < k && e[i] == pe[i].second) {
+                d /= pw[i];
+                pw[i] = 1;
+                e[i] = 0;
+                i++;
+            }
+            if (i == k) break;
+            e[i]++;
+            pw[i] *= pe[i].first;
+            d *= pe[i].first;
+        }
+    }
+
     private:
     int _n;
     std::vector<int> factor;
+};
+
+/*----------------------------------------------------------
+ - 関数名: static_prime_count
+ - 機能  : N 以下の素数の個数をコンパイル時に求める
+ - 備考  : StaticSieve の素数テーブルの大きさを決めるために用いる
+----------------------------------------------------------*/
+template <int N>
+constexpr int static_prime_count() {
+    std::array<bool, N + 1> composite{};
+    int cnt = 0;
+    for (long long i = 2; i <= N; i++) {
+        if (composite[i]) continue;
+        cnt++;
+        for (long long j = i * i; j <= N; j += i) composite[j] = true;
+    }
+    return cnt;
+}
+
+/*----------------------------------------------------------
+ - クラス名  : StaticSieve
+ - 機能      : コンパイル時にエラトステネスのふるいを実行した素数テーブル
+ - パラメータ : int N : 求める素数テーブルの最大値 (2^16 程度まで)
+ - 備考      : SieveOfEratosthenes と同じ問い合わせ関数を持つ
+               constexpr 変数として名前空間スコープに置くと、実行時の構築が不要になり
+               テーブルは読み取り専用領域に配置される
+               N = 2^16 なら g++ の既定の評価回数上限 (2^25 回) に収まり、オプションは不要
+               (コンパイル時間は 5 秒ほど増える)。N = 3e5 では上限を超えるので
+               -fconstexpr-ops-limit=... で上限を上げること
+ - 使用例    : constexpr StaticSieve<(1 << 16)> ss;
+               static_assert(ss.isPrime(65521));
+----------------------------------------------------------*/
+template <int N>
+class StaticSieve {
+    public:
+    static constexpr int PRIME_COUNT = static_prime_count<N>(); // N 以下の素数の個数
+    std::array<int, PRIME_COUNT> primes;              // 素数テーブル
+
+    /*----------------------------------------------------------
+     - 関数名: StaticSieve
+     - 機能  : コンストラクタ
+     - 備考  : 最小の素因数のテーブルと素数テーブルを構築する
+     - 計算量: O(NloglogN) (コンパイル時)
+    ----------------------------------------------------------*/
+    constexpr StaticSieve() : primes(), factor() {
+        factor[0] = factor[1] = -1;
+        int k = 0;
+        for (long long i = 2; i <= N; i++) {
+            if (factor[i] != 0) continue;
+            factor[i] = (int)i;
+            primes[k++] = (int)i;
+            for (long long j = i * i; j <= N; j += i) {
+                if (factor[j] == 0) factor[j] = (int)i;
+            }
+        }
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: isPrime
+     - 機能  : 素数なら true を返す
+     - 引数  : int x : 調べる値 (0 <= x <= N)
+     - 戻り値: x が素数なら true (範囲外なら false)
+    ----------------------------------------------------------*/
+    constexpr bool isPrime(int x) const {
+        if (x < 0 || N < x) return false;
+        return factor[x] == x;
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: factorize
+     - 機能  : 値 x の素因数分解を配列として返す
+     - 引数  : int x : 調べる値 (2 <= x <= N)
+     - 戻り値: x の素因数分解を格納した配列
+     - 備考  : SieveOfEratosthenes::factorize と同じ
+    ----------------------------------------------------------*/
+    std::vector<int> factorize(int x) const {
+        if (x < 2 || N < x) {
+            printf("[StaticSieve] Error: argument of factorize function is inappropriate.\n");
+            printf("x: %d\n", x);
+            return std::vector<int>();
+        }
+        return SieveOfEratosthenes::factorize_spf(factor.data(), x);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: factorize
+     - 機能  : 値 x を素因数分解し、(素数, 指数) の組を呼び出し側のバッファに書き込む
+     - 引数  : int x : 調べる値 (1 <= x <= N)
+               std::pair<int,int>* out : 書き込み先
+                 (SieveOfEratosthenes::MAX_DISTINCT_PRIMES 個以上の領域)
+     - 戻り値: 書き込んだ組の個数
+     - 備考  : SieveOfEratosthenes::factorize と同じ
+    ----------------------------------------------------------*/
+    int factorize(int x, std::pair<int,int>* out) const {
+        if (x < 1 || N < x) {
+            printf("[StaticSieve] Error: argument of factorize function is inappropriate.\n");
+            printf("x: %d\n", x);
+            return 0;
+        }
+        return SieveOfEratosthenes::factorize_spf(factor.data(), x, out);
+    }
+
+    /*----------------------------------------------------------
+     - 関数名: for_each_divisor
+     - 機能  : 値 x の約数全てについて f(d) を呼び出す
+     - 引数  : int x : 調べる値 (1 <= x <= N)
+               F f   : 約数 d を受け取る関数 (void(int))
+     - 備考  : SieveOfEratosthenes::for_each_divisor と同じ
+    ----------------------------------------------------------*/
+    template <class F>
+    void for_each_divisor(int x, F f) const {
+        if (x < 1 || N < x) {
+            printf("[StaticSieve] Error: argument of for_each_divisor function is inappropriate.\n");
+            printf("x: %d\n", x);
+            return;
+        }
+        SieveOfEratosthenes::for_each_divisor_spf(factor.data(), x, f);
+    }
+
+    private:
+    std::array<int, N + 1> factor; // x の最小の素因数
 };
\ No newline at end of file
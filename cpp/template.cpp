@@ -1,3 +1,15 @@
+// USE_AVX2 を定義すると AVX2 命令を使う (DynamicBitset などが 256 ビットずつ処理する)
+// ジャッジの CPU が AVX2 に対応していないと実行時エラーになるので、そのときは外す
+// (-mavx2 でコンパイルしたときは定義しなくても有効になる。C++ では #pragma GCC target で
+//  __AVX2__ が定義されないので、スニペットは USE_AVX2 で分ける)
+// #define USE_AVX2
+#if defined(__AVX2__) && !defined(USE_AVX2)
+#define USE_AVX2
+#endif
+#ifdef USE_AVX2
+#pragma GCC target("avx2,bmi2,popcnt")
+#include <immintrin.h> // _mm256_* (AVX2)
+#endif
 #include <iostream>  // cin, cout, endl
 #include <string>    // string, to_string, stoi
 #include <vector>    // vector
@@ -5,8 +17,10 @@
 #include <utility>   // pair, make_pair
 #include <tuple>     // tuple, make_tuple
 #include <array>     // array
+#include <memory>    // uninitialized_fill_n, destroy_n
 #include <cstdint>   // int64_t, int*_t
 #include <cstdio>    // printf
+#include <cstring>   // memcpy, memmove
 #include <map>       // map
 #include <queue>     // queue, priority_queue
 #include <set>       // set
@@ -19,18 +33,40 @@
 #include <cctype>    // isupper, islower, isdigit, toupper, tolower
 #include <cmath>     // sqrt
 #include <numeric>   // gcd
+#include <limits>    // numeric_limits
+#include <atomic>    // atomic
+#include <thread>    // thread
+#include <mutex>    // mutex
+#include <condition_variable>    // condition_variable
+#include <chrono>    // steady_clock
 using namespace std;
 
 // macro
 #define rep(i, n) for (int i = 0; i < (int)(n); i++)
 #define rep2(i, s, n) for (int i = (s); i < (int)(n); i++)
-#define debugVar(x) cout << #x << " : " << x << '\n'
+// FAST_OUTPUT を定義すると、答えの出力先を FastIO.cpp の fout (バッファ付き) に切り替える
+// (そのときは FastIO.cpp を using namespace std; の直後に貼ること)
+// #define FAST_OUTPUT
+#ifdef FAST_OUTPUT
+#define OUTPUT fout
+#else
+#define OUTPUT cout
+#endif
+#define debugVar(x) OUTPUT << #x << " : " << x << '\n'
+// PROFILE を定義すると debug.cpp の計測 (PROF_SCOPE, PROF_COUNT, PROF_ONLY) が有効になる
+// (そのときは debug.cpp を using namespace std; の直後に貼ること)。定義しなければ何も残らない
+// #define PROFILE
+#ifndef PROFILE
+#define PROF_SCOPE(name)
+#define PROF_COUNT(name, k)
+#define PROF_ONLY(...)
+#endif
 
 // functions
 template <typename T> void chmax(T &a, const T b) { a = max(a, b); }
 template <typename T> void chmin(T &a, const T b) { a = min(a, b); }
-void yes() { cout << "Yes" << '\n'; }
-void no()  { cout << "No"  << '\n'; }
+void yes() { OUTPUT << "Yes" << '\n'; }
+void no()  { OUTPUT << "No"  << '\n'; }
 
 // constants
 const int INF = 1001002003;
@@ -50,6 +86,7 @@ using vvvi = vector<vector<vector<int>>>;
 using vl   = vector<long long>;
 using vvl  = vector<vector<long long>>;
 using vvvl = vector<vector<vector<long long>>>;
+// 大きな多次元配列は ndarray.cpp の ndarray<T, Rank> (1つの連続した領域に置く) の方が速い
 
 int main() {
 